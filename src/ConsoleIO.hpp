@@ -0,0 +1,17 @@
+#pragma once
+
+#include "engine/GameIO.hpp"
+
+// Console front end adapter for the engine's GameIO port.
+class ConsoleIO : public GameIO {
+public:
+    std::ostream& out() override { return std::cout; }
+
+    string readLine() override {
+        string line;
+        if (!std::getline(std::cin, line)) throw InputClosed();
+        return line;
+    }
+
+    void clearScreen() override { system("cls"); }
+};
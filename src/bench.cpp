@@ -0,0 +1,261 @@
+#include "engine/Engine.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+// Microbenchmarks for the engine hot paths, e.g.
+//   bench --json results.json
+//   bench --compare results.json --filter Combat
+// Reports ns/op and heap allocations/op; the JSON output holds one benchmark per line so runs diff cleanly.
+
+static size_t allocationCount = 0;
+
+// GCC inlines the replaced operators at -O3 and then flags malloc/free against the builtin
+// new/delete it no longer sees; the pairing below is consistent.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static volatile long long benchSink = 0;
+
+struct BenchResult {
+    string name;
+    long long iterations;
+    double nsPerOp;
+    double allocsPerOp;
+};
+
+// Doubles the batch size until one batch runs for at least minSeconds, then reports that batch.
+template <class Op>
+BenchResult runBenchmark(const string& name, Op&& op, double minSeconds) {
+    for (int i = 0; i < 100; ++i) benchSink = benchSink + op();
+
+    long long iterations = 1;
+    while (true) {
+        size_t allocsBefore = allocationCount;
+        auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < iterations; ++i) benchSink = benchSink + op();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        size_t allocs = allocationCount - allocsBefore;
+
+        if (elapsed >= minSeconds || iterations >= (1LL << 40)) {
+            return {name, iterations, elapsed * 1e9 / iterations, static_cast<double>(allocs) / iterations};
+        }
+        iterations *= 2;
+    }
+}
+
+static std::map<string, BenchResult> loadResults(const string& path) {
+    std::map<string, BenchResult> results;
+    std::ifstream in(path);
+    string line;
+    while (std::getline(in, line)) {
+        size_t nameStart = line.find("\"name\": \"");
+        if (nameStart == string::npos) continue;
+        nameStart += 9;
+        size_t nameEnd = line.find('"', nameStart);
+        BenchResult r{line.substr(nameStart, nameEnd - nameStart), 0, 0.0, 0.0};
+        std::sscanf(line.c_str() + nameEnd, "\", \"iterations\": %lld, \"ns_per_op\": %lf, \"allocs_per_op\": %lf",
+                    &r.iterations, &r.nsPerOp, &r.allocsPerOp);
+        results[r.name] = r;
+    }
+    return results;
+}
+
+static void writeResults(const string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << ", \"ns_per_op\": " << std::fixed << std::setprecision(2) << r.nsPerOp
+            << ", \"allocs_per_op\": " << std::setprecision(3) << r.allocsPerOp << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char* argv[]) {
+    string filter;
+    string jsonPath;
+    string comparePath;
+    double minSeconds = 0.2;
+    const char* usage = "Options: --filter <substring> --json <file> --compare <file> --min-time <seconds>\n";
+    for (int i = 1; i < argc; i += 2) {
+        string flag = argv[i];
+        string value = i + 1 < argc ? argv[i + 1] : "";
+        if (flag == "--filter") filter = value;
+        else if (flag == "--json") jsonPath = value;
+        else if (flag == "--compare") comparePath = value;
+        else if (flag == "--min-time") minSeconds = std::atof(value.c_str());
+        else {
+            std::cerr << "Unknown option: " << flag << "\n" << usage;
+            return 1;
+        }
+        if (i + 1 == argc) {
+            std::cerr << "Missing value for " << flag << "\n" << usage;
+            return 1;
+        }
+    }
+
+    std::ostream nullStream(nullptr);
+    ScriptedIO io({}, &nullStream);
+    GameIOScope ioScope(io);
+    CounterRng benchStream(42);
+    RandomScope randomScope(benchStream);
+
+    const PlayerRaceDatabase& raceDb = gameData().races;
+    const PlayerClassCollection& classDb = gameData().classes;
+    Player hero = createPlayer("Gwensent", raceDb.templates[0], classDb.templates[0]);
+    EnemyController enemyCtrl;
+    const EnemyDatabase& enemyDB = gameData().enemies;
+    CombatSystem combat;
+    NPCGenerator npcGen;
+    const ResidentNPC resident = npcGen.generateResident(3);
+    PopulationGenerator populationGen;
+    PopulationConfig populationConfig;
+    populationConfig.residentsPerSettlement = 300;
+    populationConfig.reservedNames = 0;
+    NPCGenerator populationNames;
+    PlayerInventory inventory;
+    Economy economy;
+
+    Enemy wolf = enemyCtrl.getEnemyByName("Wolf", 1);
+    const EnemyStats wolfStats = wolf.stats;
+    PlayerCombatant heroC(hero);
+    EnemyCombatant wolfC(wolf);
+
+    CombatLog combatLog;
+    const uint16_t heroId = combatLog.addParticipant(hero.name);
+    const uint16_t wolfId = combatLog.addParticipant(wolf.name());
+
+    CombatArena horde;
+    for (int i = 0; i < 8; ++i) horde.addEnemy(enemyCtrl.getEnemyByName("Cutpurse", 1));
+    const int heroHitpoints = hero.stats.hitpoints;
+
+    const size_t batchLanes = 1024;
+    std::vector<float> laneAttack(batchLanes), laneMagicAttack(batchLanes), laneCritRate(batchLanes), laneCritDamage(batchLanes);
+    std::vector<float> laneArmor(batchLanes), laneMagicArmor(batchLanes), laneDodgeRate(batchLanes);
+    for (size_t i = 0; i < batchLanes; ++i) {
+        const auto& tmpl = enemyDB.templates[i % enemyDB.templates.size()].stats.data;
+        laneAttack[i] = static_cast<float>(tmpl.attack);
+        laneMagicAttack[i] = static_cast<float>(tmpl.magicAttack);
+        laneCritRate[i] = tmpl.critRate;
+        laneCritDamage[i] = tmpl.critDamage;
+        laneArmor[i] = tmpl.armor;
+        laneMagicArmor[i] = tmpl.magicArmor;
+        laneDodgeRate[i] = tmpl.dodgeRate;
+    }
+    DamageLanes batchOut;
+
+    Enemy scaledEnemy{EnemyId(0), enemyDB.templates[0].stats, {}};
+    const EnemyStats unscaledStats = scaledEnemy.stats;
+
+    const size_t stackCount = 50;
+    for (size_t i = 0; i < stackCount; ++i) {
+        inventory.addItem(PlayerInventory::ItemType::Equipment, i % inventory.equipmentDB.getEquipment().size());
+    }
+    size_t nextStack = 0;
+
+    std::vector<std::pair<string, std::function<long long()>>> benchmarks = {
+        {"CombatSystem::attack", [&]() -> long long {
+            if (wolf.stats.data.hitpoints <= 0) wolf.stats = wolfStats;
+            return combat.attack(heroC, wolfC).totalDamage;
+        }},
+        {"CombatLog::pushAttack", [&]() -> long long {
+            if (wolf.stats.data.hitpoints <= 0) wolf.stats = wolfStats;
+            combatLog.pushAttack(heroId, wolfId, combat.attack(heroC, wolfC));
+            return static_cast<long long>(combatLog.size());
+        }},
+        {"CombatSystem::calculateDamage", [&]() -> long long {
+            return combat.calculateDamage(hero.stats.attack, wolfStats.data.armor);
+        }},
+        {"CombatSystem::resolveBatch(1024)", [&]() -> long long {
+            combat.resolveBatch<false, false>({laneAttack.data(), laneMagicAttack.data(), laneCritRate.data(), laneCritDamage.data()},
+                                              {laneArmor.data(), laneMagicArmor.data(), laneDodgeRate.data()}, batchLanes, batchOut);
+            return batchOut.total[0];
+        }},
+        {"CombatArena::resolveWave(8)", [&]() -> long long {
+            hero.stats.hitpoints = heroHitpoints;
+            return horde.resolveWave(combat, heroC);
+        }},
+        {"NPCGenerator::generateNPC", [&]() -> long long {
+            NPC npc = npcGen.generateNPC(3);
+            npcGen.releaseName(npc);
+            return npc.level;
+        }},
+        {"NPCGenerator::materialize", [&]() -> long long {
+            return NPCGenerator::materialize(resident).stats.attack;
+        }},
+        {"PopulationGenerator::populate(2x300)", [&]() -> long long {
+            const WorldPopulation world = populationGen.populate(populationConfig, populationNames);
+            world.releaseNames(populationNames);
+            return static_cast<long long>(world.size());
+        }},
+        {"EnemyDatabase::getRandomEnemy", [&]() -> long long {
+            return enemyDB.getRandomEnemy(5, Terrain).stats.data.hitpoints;
+        }},
+        {"NameLookup::find", [&]() -> long long {
+            return static_cast<long long>(enemyDB.byName.find("Cutpurse"));
+        }},
+        {"EnemyController::enemyScaleLevel", [&]() -> long long {
+            scaledEnemy.stats = unscaledStats;
+            enemyCtrl.enemyScaleLevel(scaledEnemy, 5, Dungeon);
+            return scaledEnemy.stats.data.hitpoints;
+        }},
+        {"PlayerInventory::addItem", [&]() -> long long {
+            nextStack = (nextStack + 1) % stackCount;
+            inventory.addItem(PlayerInventory::ItemType::Equipment, nextStack % inventory.equipmentDB.getEquipment().size());
+            return static_cast<long long>(inventory.items.size());
+        }},
+        {"PlayerInventory construction", [&]() -> long long {
+            PlayerInventory fresh;
+            return static_cast<long long>(fresh.items.size() + fresh.potionDB.getPotions().size());
+        }},
+        {"Economy::subtractCurrency", [&]() -> long long {
+            if (!economy.subtractCurrency(coins(0, 0, 1, 37))) economy = Economy(10, 0, 0, 0);
+            return economy.copper;
+        }},
+        {"Economy::addCurrency", [&]() -> long long {
+            economy.addCurrency(5000);
+            if (economy.copper > coins(1000, 0, 0, 0)) economy = Economy();
+            return economy.copper;
+        }},
+    };
+
+    std::vector<BenchResult> results;
+    for (auto& bench : benchmarks) {
+        if (!filter.empty() && bench.first.find(filter) == string::npos) continue;
+        results.push_back(runBenchmark(bench.first, bench.second, minSeconds));
+    }
+
+    std::map<string, BenchResult> baseline;
+    if (!comparePath.empty()) baseline = loadResults(comparePath);
+
+    std::cout << std::left << std::setw(36) << "benchmark" << std::right << std::setw(14) << "ns/op"
+              << std::setw(14) << "allocs/op" << (baseline.empty() ? "" : "      vs baseline") << "\n";
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(36) << r.name << std::right << std::fixed
+                  << std::setw(14) << std::setprecision(2) << r.nsPerOp
+                  << std::setw(14) << std::setprecision(3) << r.allocsPerOp;
+        auto it = baseline.find(r.name);
+        if (it != baseline.end() && it->second.nsPerOp > 0) {
+            std::cout << std::setw(16) << std::setprecision(2) << (r.nsPerOp / it->second.nsPerOp) << "x";
+        }
+        std::cout << "\n";
+    }
+
+    if (!jsonPath.empty()) writeResults(jsonPath, results);
+    return 0;
+}
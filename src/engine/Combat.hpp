@@ -0,0 +1,174 @@
+#pragma once
+
+#include "EnemyController.hpp"
+#include "NPC.hpp"
+#include "Names.hpp"
+#include "DamageKernel.hpp"
+
+#include <variant>
+
+struct CombatResult {
+    int physicalDamage;
+    int magicalDamage;
+    int totalDamage;
+    bool isCrit;
+    bool dodge;
+    DebuffId debuffInflicted; // invalid when none landed
+    int debuffDamage;    // proc damage dealt as the debuff landed
+};
+
+// Combatant views are plain classes with inline accessors; CombatSystem::attack is a template over
+// them, so every stat read inlines instead of going through a vtable. Weapon debuffs are part of
+// every view (empty for NPCs and enemies), which removes the need to RTTI-check for the player.
+// Stat reads already include the penalties of active debuffs.
+inline const std::vector<DebuffId> noWeaponDebuffs;
+
+class NPCCombatant final {
+public:
+    NPCCombatant(NPC& n) : npc(n) {}
+    const string& getName() const { return npc.name; }
+    int getPhysicalAttack() const { return std::max(0, npc.stats.attack - npc.debuffs.modifiers().attack); }
+    int getMagicAttack() const { return std::max(0, npc.stats.magicAttack - npc.debuffs.modifiers().magicAttack); }
+    float getArmor() const { return std::max(0.0f, npc.stats.armor - npc.debuffs.modifiers().armor); }
+    float getMagicArmor() const { return std::max(0.0f, npc.stats.magicArmor - npc.debuffs.modifiers().magicArmor); }
+    float getCritRate() const { return npc.stats.critRate; }
+    float getCritDamage() const { return npc.stats.critDamage; }
+    float getDodgeRate() const { return npc.stats.dodgeRate; }
+    bool isPlayer() const { return false; }
+    void takeDamage(int amount) { npc.stats.hitpoints -= amount; }
+    const DebuffSet& getDebuffs() const { return npc.debuffs; }
+    int applyDebuff(DebuffId id) {
+        int proc = npc.debuffs.apply(gameData().debuffs, id);
+        npc.stats.hitpoints -= proc;
+        return proc;
+    }
+    const std::vector<DebuffId>& getWeaponDebuffs() const { return noWeaponDebuffs; }
+    float getWeaponDebuffChance() const { return 0.0f; }
+
+private:
+    NPC& npc;
+};
+
+class PlayerCombatant final {
+public:
+    PlayerCombatant(Player& p) : player(p) {}
+    const string& getName() const { return player.name; }
+    int getPhysicalAttack() const { return std::max(0, player.stats.attack - player.debuffs.modifiers().attack); }
+    int getMagicAttack() const { return std::max(0, player.stats.magicAttack - player.debuffs.modifiers().magicAttack); }
+    float getArmor() const { return std::max(0.0f, player.stats.armor - player.debuffs.modifiers().armor); }
+    float getMagicArmor() const { return std::max(0.0f, player.stats.magicArmor - player.debuffs.modifiers().magicArmor); }
+    float getCritRate() const { return player.stats.critRate; }
+    float getCritDamage() const { return player.stats.critDamage; }
+    float getDodgeRate() const { return player.stats.dodgeRate; }
+    bool isPlayer() const { return true; }
+    void takeDamage(int amount) { player.stats.hitpoints -= amount; }
+    const DebuffSet& getDebuffs() const { return player.debuffs; }
+    int applyDebuff(DebuffId id) {
+        int proc = player.debuffs.apply(gameData().debuffs, id);
+        player.stats.hitpoints -= proc;
+        return proc;
+    }
+    const std::vector<DebuffId>& getWeaponDebuffs() const { return player.equippedWeaponDebuffs; }
+    float getWeaponDebuffChance() const { return player.equippedWeaponDebuffChance; }
+
+private:
+    Player& player;
+};
+
+class EnemyCombatant final {
+public:
+    EnemyCombatant(Enemy& e) : enemy(e) {}
+    std::string_view getName() const { return enemy.name(); }
+    int getPhysicalAttack() const { return std::max(0, enemy.stats.data.attack - enemy.debuffs.modifiers().attack); }
+    int getMagicAttack() const { return std::max(0, enemy.stats.data.magicAttack - enemy.debuffs.modifiers().magicAttack); }
+    float getArmor() const { return std::max(0.0f, enemy.stats.data.armor - enemy.debuffs.modifiers().armor); }
+    float getMagicArmor() const { return std::max(0.0f, enemy.stats.data.magicArmor - enemy.debuffs.modifiers().magicArmor); }
+    float getCritRate() const { return enemy.stats.data.critRate; }
+    float getCritDamage() const { return enemy.stats.data.critDamage; }
+    float getDodgeRate() const { return enemy.stats.data.dodgeRate; }
+    bool isPlayer() const { return false; }
+    void takeDamage(int amount) { enemy.stats.data.hitpoints -= amount; }
+    const DebuffSet& getDebuffs() const { return enemy.debuffs; }
+    int applyDebuff(DebuffId id) {
+        int proc = enemy.debuffs.apply(gameData().debuffs, id);
+        enemy.stats.data.hitpoints -= proc;
+        return proc;
+    }
+    const std::vector<DebuffId>& getWeaponDebuffs() const { return noWeaponDebuffs; }
+    float getWeaponDebuffChance() const { return 0.0f; }
+
+private:
+    Enemy& enemy;
+};
+
+// For mixed lists of combatants (e.g. a party roster); dispatch is a std::visit jump table, not a vtable.
+using Combatant = std::variant<PlayerCombatant, NPCCombatant, EnemyCombatant>;
+
+class CombatSystem {
+public:
+    // By default a combat system forks its own stream off the thread's session stream.
+    CombatSystem() : rng(randomStream().fork()) {}
+    CombatSystem(const CounterRng& stream) : rng(stream) {}
+
+    // Each simulation worker owns a CombatSystem, so every thread draws from its own stream.
+    void reseed(const CounterRng& stream) { rng = stream; }
+
+    template <class Attacker, class Target>
+    CombatResult attack(Attacker& attacker, Target& target) {
+        bool dodge = false;
+        if (rng.uniform() < target.getDodgeRate()) {
+            dodge = true;
+        }
+
+        int physicalDamage = 0;
+        int magicalDamage = 0;
+        int totalDamage = 0;
+        bool isCrit = false;
+        DebuffId debuffInflicted;
+        int debuffDamage = 0;
+
+        if (!dodge) {
+            physicalDamage = calculateDamage(attacker.getPhysicalAttack(), target.getArmor());
+            magicalDamage = calculateDamage(attacker.getMagicAttack(), target.getMagicArmor());
+            totalDamage = physicalDamage + magicalDamage;
+
+         
+            if (rng.uniform() < attacker.getCritRate()) {
+                isCrit = true;
+                totalDamage = static_cast<int>(std::round(totalDamage * attacker.getCritDamage()));
+            }
+
+            target.takeDamage(totalDamage);
+
+            
+            const auto& weaponDebuffs = attacker.getWeaponDebuffs();
+            if (!weaponDebuffs.empty() && rng.uniform() < attacker.getWeaponDebuffChance()) {
+                debuffInflicted = rng.pick(weaponDebuffs);
+                debuffDamage = target.applyDebuff(debuffInflicted);
+            }
+        }
+
+        return {physicalDamage, magicalDamage, totalDamage, isCrit, dodge, debuffInflicted, debuffDamage};
+    }
+
+    CombatResult attack(Combatant& attacker, Combatant& target) {
+        return std::visit([this](auto& a, auto& t) { return attack(a, t); }, attacker, target);
+    }
+
+    float roll() { return rng.uniform(); }
+
+    // Same ±15% jitter as the batch kernel.
+    int calculateDamage(int attack, float defense) {
+        float baseDamage = static_cast<float>(attack) * (1.0f - defense);
+        float damage = baseDamage + baseDamage * (rng.uniform() * 0.3f - 0.15f);
+        return static_cast<int>(std::round(std::max<float>(damage, 0.0f)));
+    }
+
+    template <bool BroadcastAttacker, bool BroadcastTarget>
+    void resolveBatch(const AttackerLanes& attacker, const TargetLanes& target, size_t count, DamageLanes& out) {
+        resolveDamageBatch<BroadcastAttacker, BroadcastTarget>(attacker, target, count, rng, out);
+    }
+
+private:
+    CounterRng rng;
+};
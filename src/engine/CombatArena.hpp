@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Combat.hpp"
+
+// The enemy side of an encounter, stored as parallel arrays so a whole wave resolves in one
+// tight loop; a horde of dozens costs about the same per enemy as a single duel.
+class CombatArena {
+public:
+    // Combatant view of one arena slot, usable with CombatSystem::attack.
+    class SlotCombatant final {
+    public:
+        SlotCombatant(CombatArena& a, size_t s) : arena(a), slot(s) {}
+        const string& getName() const { return arena.labels[slot]; }
+        int getPhysicalAttack() const { return static_cast<int>(arena.attack[slot]); }
+        int getMagicAttack() const { return static_cast<int>(arena.magicAttack[slot]); }
+        float getArmor() const { return arena.armor[slot]; }
+        float getMagicArmor() const { return arena.magicArmor[slot]; }
+        float getCritRate() const { return arena.critRate[slot]; }
+        float getCritDamage() const { return arena.critDamage[slot]; }
+        float getDodgeRate() const { return arena.dodgeRate[slot]; }
+        bool isPlayer() const { return false; }
+        void takeDamage(int amount) { arena.hitpoints[slot] -= amount; }
+        const DebuffSet& getDebuffs() const { return arena.enemies[slot].debuffs; }
+        int applyDebuff(DebuffId id) { return arena.applyDebuff(slot, id); }
+        const std::vector<DebuffId>& getWeaponDebuffs() const { return noWeaponDebuffs; }
+        float getWeaponDebuffChance() const { return 0.0f; }
+
+    private:
+        CombatArena& arena;
+        size_t slot;
+    };
+
+    size_t addEnemy(const Enemy& enemy) {
+        const auto& data = enemy.stats.data;
+        hitpoints.push_back(data.hitpoints);
+        maxHitpoints.push_back(data.maxHitpoints);
+        attack.push_back(0.0f);
+        magicAttack.push_back(0.0f);
+        armor.push_back(0.0f);
+        magicArmor.push_back(0.0f);
+        critRate.push_back(data.critRate);
+        critDamage.push_back(data.critDamage);
+        dodgeRate.push_back(data.dodgeRate);
+        enemies.push_back(enemy);
+        refreshLanes(enemies.size() - 1);
+
+        // Duplicate names get a number so the log can tell "Cutpurse #2" from "Cutpurse #3".
+        const string name(enemy.name());
+        int sameName = 0;
+        for (const auto& e : enemies) {
+            if (e.id == enemy.id) sameName++;
+        }
+        labels.push_back(sameName > 1 ? name + " #" + std::to_string(sameName) : name);
+        if (sameName == 2) {
+            for (size_t i = 0; i + 1 < enemies.size(); ++i) {
+                if (enemies[i].id == enemy.id) labels[i] = name + " #1";
+            }
+        }
+        return enemies.size() - 1;
+    }
+
+    size_t size() const { return hitpoints.size(); }
+    bool isAlive(size_t slot) const { return hitpoints[slot] > 0; }
+
+    size_t aliveCount() const {
+        size_t alive = 0;
+        for (int hp : hitpoints) {
+            if (hp > 0) alive++;
+        }
+        return alive;
+    }
+
+    std::optional<size_t> firstAlive() const {
+        for (size_t i = 0; i < hitpoints.size(); ++i) {
+            if (hitpoints[i] > 0) return i;
+        }
+        return std::nullopt;
+    }
+
+    // Returns the proc damage, already taken off the slot's hitpoints.
+    int applyDebuff(size_t slot, DebuffId id) {
+        int proc = enemies[slot].debuffs.apply(gameData().debuffs, id);
+        hitpoints[slot] -= proc;
+        refreshLanes(slot);
+        return proc;
+    }
+
+    template <class OnEffect>
+    int tickDebuffs(size_t slot, OnEffect&& onEffect) {
+        DebuffSet& debuffs = enemies[slot].debuffs;
+        if (debuffs.empty()) return 0;
+        int damage = debuffs.tick(gameData().debuffs, onEffect);
+        hitpoints[slot] -= damage;
+        refreshLanes(slot);
+        return damage;
+    }
+
+    const DamageLanes& lastWave() const { return wave; }
+    SlotCombatant slotCombatant(size_t slot) { return SlotCombatant(*this, slot); }
+    const string& label(size_t slot) const { return labels[slot]; }
+    Enemy& enemy(size_t slot) { return enemies[slot]; }
+    const Enemy& enemy(size_t slot) const { return enemies[slot]; }
+
+    // Every living enemy swings at `target` once. The whole wave goes through the batch damage
+    // kernel and the summed damage is applied in a single takeDamage call; per-slot outcomes stay
+    // readable through lastWave() until the next wave.
+    template <class Target>
+    int resolveWave(CombatSystem& combat, Target& target) {
+        const float targetArmor = target.getArmor();
+        const float targetMagicArmor = target.getMagicArmor();
+        const float targetDodge = target.getDodgeRate();
+        combat.resolveBatch<false, true>({attack.data(), magicAttack.data(), critRate.data(), critDamage.data()},
+                                         {&targetArmor, &targetMagicArmor, &targetDodge}, size(), wave);
+
+        int waveDamage = 0;
+        for (size_t i = 0; i < hitpoints.size(); ++i) {
+            if (hitpoints[i] <= 0) continue;
+            waveDamage += wave.total[i];
+        }
+
+        target.takeDamage(waveDamage);
+        return waveDamage;
+    }
+
+    std::vector<int> hitpoints;
+    std::vector<int> maxHitpoints;
+    std::vector<float> attack;
+    std::vector<float> magicAttack;
+    std::vector<float> armor;
+    std::vector<float> magicArmor;
+    std::vector<float> critRate;
+    std::vector<float> critDamage;
+    std::vector<float> dodgeRate;
+
+private:
+    // The hot lanes hold base stats minus debuff penalties.
+    void refreshLanes(size_t slot) {
+        const auto& data = enemies[slot].stats.data;
+        const DebuffModifiers& mods = enemies[slot].debuffs.modifiers();
+        attack[slot] = static_cast<float>(std::max(0, data.attack - mods.attack));
+        magicAttack[slot] = static_cast<float>(std::max(0, data.magicAttack - mods.magicAttack));
+        armor[slot] = std::max(0.0f, data.armor - mods.armor);
+        magicArmor[slot] = std::max(0.0f, data.magicArmor - mods.magicArmor);
+    }
+
+    std::vector<Enemy> enemies; // cold data: names, loot, debuffs
+    std::vector<string> labels;
+    DamageLanes wave; // kernel output, reused between rounds
+};
+
+inline void awardDefeatedEnemies(Player& hero, const CombatArena& arena, EnemyController& enemyCtrl) {
+    for (size_t i = 0; i < arena.size(); ++i) {
+        if (!arena.isAlive(i)) enemyCtrl.enemyGoldExpDrop(hero, arena.enemy(i));
+    }
+}
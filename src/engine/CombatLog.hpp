@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Combat.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Spell effects must stay last: they attach to the SpellCast before them when rendered.
+enum class CombatEventKind : uint8_t {
+    Attack,
+    DebuffDamage,
+    DebuffExpired,
+    SpellCast,
+    SpellManaDrain,
+    SpellHeal,
+    SpellManaRestore,
+    SpellArmor,
+    SpellMagicArmor,
+    SpellDebuff
+};
+
+// One swing or one effect of a spell. Fixed size and trivially copyable: logging costs a few
+// stores into the ring, and names are only looked up when the log is rendered.
+struct CombatEvent {
+    static constexpr uint8_t Crit = 1;
+    static constexpr uint8_t Dodge = 2;
+
+    CombatEventKind kind;
+    uint8_t flags;  // Crit | Dodge
+    uint16_t actor; // participant id
+    uint16_t target;
+    uint16_t detail; // DebuffDatabase index for Attack and the debuff kinds, spell index for SpellCast, noDetail for none
+    int32_t amount; // damage, healing or mana
+};
+static_assert(sizeof(CombatEvent) == 12, "CombatEvent should stay packed");
+
+// Ring buffer of the last `capacity` events of one combat. Events carry small ids; the names they
+// refer to are registered once per combat, so a swing never touches a string.
+class CombatLog {
+public:
+    static constexpr size_t capacity = 256;
+    static constexpr uint16_t noDetail = 0xFFFF; // same as an invalid ContentId
+
+    uint16_t addParticipant(std::string_view name) {
+        participants.emplace_back(name);
+        return static_cast<uint16_t>(participants.size() - 1);
+    }
+
+    void push(const CombatEvent& event) { events[written++ % capacity] = event; }
+
+    void pushAttack(uint16_t actor, uint16_t target, const CombatResult& result) {
+        uint8_t flags = static_cast<uint8_t>((result.isCrit ? CombatEvent::Crit : 0) | (result.dodge ? CombatEvent::Dodge : 0));
+        const uint16_t debuff = result.debuffInflicted.valid() ? result.debuffInflicted.value : noDetail;
+        push({CombatEventKind::Attack, flags, actor, target, debuff, result.totalDamage});
+        if (result.debuffDamage > 0) {
+            push({CombatEventKind::DebuffDamage, 0, target, target, debuff, result.debuffDamage});
+        }
+    }
+
+    // Sequence number of the next event; pass an earlier value to render() to get what came after it.
+    uint64_t size() const { return written; }
+    uint64_t oldest() const { return written > capacity ? written - capacity : 0; }
+    const CombatEvent& at(uint64_t sequence) const { return events[sequence % capacity]; }
+
+    // One line per swing or spell cast, for the events from `from` onwards that are still in the ring.
+    std::vector<string> render(uint64_t from, const SpellDatabase& spellDB, const DebuffDatabase& debuffDB) const {
+        std::vector<string> lines;
+        bool spellOpen = false;
+        for (uint64_t seq = std::max(from, oldest()); seq < written; ++seq) {
+            const CombatEvent& e = at(seq);
+            // An effect whose cast already fell out of the ring has nothing to attach to.
+            if (e.kind >= CombatEventKind::SpellManaDrain && !spellOpen) continue;
+            const string& actor = participants[e.actor];
+            const string& target = participants[e.target];
+            if (spellOpen && e.kind < CombatEventKind::SpellManaDrain) {
+                lines.back() += ".";
+                spellOpen = false;
+            }
+            switch (e.kind) {
+                case CombatEventKind::Attack:
+                    if (e.flags & CombatEvent::Dodge) {
+                        lines.push_back(actor + " attacked " + target + " but " + target + " dodged!");
+                    } else {
+                        lines.push_back(actor + " attacked " + target + " and dealt " + std::to_string(e.amount) + " damage" +
+                                        ((e.flags & CombatEvent::Crit) ? " (Critical Hit!)" : "") + ".");
+                    }
+                    break;
+                case CombatEventKind::DebuffDamage:
+                    lines.push_back(actor + " suffers " + std::to_string(e.amount) + " damage from " + debuffName(debuffDB, e.detail) + ".");
+                    break;
+                case CombatEventKind::DebuffExpired:
+                    lines.push_back(debuffName(debuffDB, e.detail) + " on " + actor + " wore off.");
+                    break;
+                case CombatEventKind::SpellCast:
+                    lines.push_back(actor + " cast " + string(spellDB.getSpells()[e.detail].spellName));
+                    if (e.amount > 0) lines.back() += " and dealt " + std::to_string(e.amount) + " damage";
+                    spellOpen = true;
+                    break;
+                case CombatEventKind::SpellManaDrain:
+                    lines.back() += " and drained " + std::to_string(e.amount) + " mana";
+                    break;
+                case CombatEventKind::SpellHeal:
+                    lines.back() += " and healed " + std::to_string(e.amount) + " HP";
+                    break;
+                case CombatEventKind::SpellManaRestore:
+                    lines.back() += " and restored " + std::to_string(e.amount) + " mana";
+                    break;
+                case CombatEventKind::SpellArmor:
+                    lines.back() += " and increased armor";
+                    break;
+                case CombatEventKind::SpellMagicArmor:
+                    lines.back() += " and increased magic armor";
+                    break;
+                case CombatEventKind::SpellDebuff:
+                    lines.back() += " and applied " + debuffName(debuffDB, e.detail);
+                    break;
+            }
+        }
+        if (spellOpen) lines.back() += ".";
+        return lines;
+    }
+
+private:
+    static string debuffName(const DebuffDatabase& debuffDB, uint16_t id) {
+        return string(debuffDB.getDebuffs()[id].name);
+    }
+
+    std::array<CombatEvent, capacity> events{};
+    uint64_t written = 0;
+    std::vector<string> participants;
+};
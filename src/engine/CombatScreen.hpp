@@ -0,0 +1,268 @@
+#pragma once
+
+#include "CombatArena.hpp"
+#include "CombatLog.hpp"
+#include "Inventory.hpp"
+
+class CombatScreen {
+public:
+    CombatScreen(Player& pl, std::vector<NPC>& prty, CombatArena& ar, TimeSystem& ts, NPCGenerator& gen)
+        : player(pl), party(prty), arena(ar), playerC(pl), log(), drawnUpTo(0), timeSystem(ts), npcGen(gen) {
+        playerId = log.addParticipant(player.name);
+        firstEnemyId = static_cast<uint16_t>(playerId + 1);
+        for (size_t i = 0; i < arena.size(); ++i) {
+            log.addParticipant(arena.label(i));
+        }
+        for (const auto& npc : party) {
+            partyIds.push_back(log.addParticipant(npc.name));
+        }
+    }
+
+    void startCombat(CombatSystem& combat, PlayerInventory& inventory) {
+        bool inCombat = true;
+
+        while (inCombat && (player.stats.hitpoints > 0 || !party.empty()) && arena.aliveCount() > 0) {
+            displayCombatScreen();
+
+         
+            int action = getPlayerActionInput();
+            switch (action) {
+                case 1: 
+                    handlePlayerAttack(combat);
+                    break;
+                case 2: 
+                    inventory.showInventory(player);
+                    break;
+                case 3:
+                    gameOut() << "You ran away!" << endl;
+                    inCombat = false;
+                    continue;
+                case 4:
+                    handleCastSpell();
+                    break;
+                default:
+                    gameOut() << "Invalid choice!" << endl;
+                    break;
+            }
+
+           
+            removeFallenPartyMembers();
+            for (size_t i = 0; i < party.size(); ++i) {
+                std::optional<size_t> target = arena.firstAlive();
+                if (!target) break;
+                NPCCombatant npcC(party[i]);
+                CombatArena::SlotCombatant enemyC = arena.slotCombatant(*target);
+                log.pushAttack(partyIds[i], enemyId(*target), combat.attack(npcC, enemyC));
+            }
+
+         
+            handleEnemyTurn(combat);
+            tickDebuffs();
+
+            inventory.tickBuffs(player);
+            clearScreen();
+
+            removeFallenPartyMembers();
+        }
+
+        // Debuff durations and spell wards count combat rounds, so nothing carries over to the next fight.
+        player.debuffs.clear();
+        player.setStatLayer(StatLayer::SpellWards, Stats{});
+        for (auto& npc : party) {
+            npc.debuffs.clear();
+        }
+        displayCombatOutcome();
+    }
+
+private:
+    Player& player;
+    std::vector<NPC>& party;
+    CombatArena& arena;
+    PlayerCombatant playerC;
+    CombatLog log;
+    uint64_t drawnUpTo; // log position the last drawn screen ended at
+    uint16_t playerId = 0;
+    uint16_t firstEnemyId = 0;
+    std::vector<uint16_t> partyIds; // parallel to party
+    TimeSystem timeSystem;
+    NPCGenerator& npcGen;
+    const SpellDatabase& spellDB = gameData().spells;
+
+
+
+    void displayCombatScreen() {
+        std::vector<string> lines;
+        lines.push_back(player.name + " - HP: " + std::to_string(player.stats.hitpoints) + "/" + std::to_string(player.stats.maxHitpoints) + " MP: " + std::to_string(player.stats.mana) + "/" + std::to_string(player.stats.maxMana));
+        const DebuffDatabase& debuffDB = gameData().debuffs;
+        if (!player.debuffs.empty()) {
+            lines.push_back("Debuffs: " + player.debuffs.describe(debuffDB));
+        }
+        for (const auto& npc : party) {
+            lines.push_back(npc.name + " - HP: " + std::to_string(npc.stats.hitpoints) + "/" + std::to_string(npc.stats.maxHitpoints));
+            if (!npc.debuffs.empty()) {
+                lines.push_back("Debuffs: " + npc.debuffs.describe(debuffDB));
+            }
+        }
+        for (size_t i = 0; i < arena.size(); ++i) {
+            if (!arena.isAlive(i)) continue;
+            lines.push_back(arena.label(i) + " - HP: " + std::to_string(arena.hitpoints[i]) + "/" + std::to_string(arena.maxHitpoints[i]));
+            const DebuffSet& enemyDebuffs = arena.enemy(i).debuffs;
+            if (!enemyDebuffs.empty()) {
+                lines.push_back("Debuffs: " + enemyDebuffs.describe(debuffDB));
+            }
+        }
+        for (auto& line : log.render(drawnUpTo, spellDB, debuffDB)) {
+            lines.push_back(std::move(line));
+        }
+        displayBorderedMenu(lines, "");
+        drawnUpTo = log.size();
+    }
+
+    uint16_t enemyId(size_t slot) const { return static_cast<uint16_t>(firstEnemyId + slot); }
+
+    void removeFallenPartyMembers() {
+        for (size_t i = party.size(); i-- > 0; ) {
+            if (party[i].stats.hitpoints > 0) continue;
+            npcGen.releaseName(party[i]);
+            party.erase(party.begin() + static_cast<long>(i));
+            partyIds.erase(partyIds.begin() + static_cast<long>(i));
+        }
+    }
+
+    int getPlayerActionInput() const {
+        gameOut() << "\nChoose your action:" << endl;
+        gameOut() << "1. Attack" << endl;
+        gameOut() << "2. Use Item / Potion" << endl;
+        gameOut() << "3. Run" << endl;
+        if (!player.learnedSpells.empty()) {
+            gameOut() << "4. Cast Spell" << endl;
+            return getNumberInput(1, 4);
+        }
+
+        return getNumberInput(1, 3);
+    }
+
+    // With a single enemy left there is nothing to choose.
+    size_t chooseTarget() const {
+        std::vector<size_t> alive;
+        for (size_t i = 0; i < arena.size(); ++i) {
+            if (arena.isAlive(i)) alive.push_back(i);
+        }
+        if (alive.size() == 1) return alive.front();
+
+        gameOut() << "Choose a target:" << endl;
+        for (size_t j = 0; j < alive.size(); ++j) {
+            gameOut() << j + 1 << ". " << arena.label(alive[j]) << " (HP: " << arena.hitpoints[alive[j]] << ")" << endl;
+        }
+        return alive[static_cast<size_t>(getNumberInput(1, static_cast<int>(alive.size())) - 1)];
+    }
+
+    void handlePlayerAttack(CombatSystem& combat) {
+        size_t target = chooseTarget();
+        CombatArena::SlotCombatant enemyC = arena.slotCombatant(target);
+        log.pushAttack(playerId, enemyId(target), combat.attack(playerC, enemyC));
+    }
+
+    void handleCastSpell() {
+        if (player.learnedSpells.empty()) return;
+
+        gameOut() << "Choose a spell to cast:" << endl;
+        const NameRegistry& names = nameRegistry();
+        for (size_t i = 0; i < player.learnedSpells.size(); ++i) {
+            gameOut() << i + 1 << ". " << names.spells.name(player.learnedSpells[i]) << endl;
+        }
+        int choice = getNumberInput(1, static_cast<int>(player.learnedSpells.size()));
+        const SpellId spellId = player.learnedSpells[static_cast<size_t>(choice - 1)];
+        const auto& spell = spellDB.getSpells()[spellId.index()];
+
+        if (player.stats.mana < spell.manaCost) {
+            gameOut() << "Mana insufficient" << endl;
+            return;
+        }
+
+        size_t target = chooseTarget();
+        Enemy& enemy = arena.enemy(target);
+        const uint16_t targetId = enemyId(target);
+        player.stats.mana -= spell.manaCost;
+        log.push({CombatEventKind::SpellCast, 0, playerId, targetId, spellId.value, std::max(spell.healthDamage, 0)});
+
+        if (spell.healthDamage > 0) {
+            arena.hitpoints[target] -= spell.healthDamage;
+        }
+        if (spell.manaDamage > 0) {
+            enemy.stats.data.mana -= spell.manaDamage;
+            if (enemy.stats.data.mana < 0) enemy.stats.data.mana = 0;
+            log.push({CombatEventKind::SpellManaDrain, 0, playerId, targetId, CombatLog::noDetail, spell.manaDamage});
+        }
+        if (spell.healthRestore > 0) {
+            int heal = std::min(spell.healthRestore, player.stats.maxHitpoints - player.stats.hitpoints);
+            player.stats.hitpoints += heal;
+            log.push({CombatEventKind::SpellHeal, 0, playerId, playerId, CombatLog::noDetail, heal});
+        }
+        if (spell.manaRestore > 0) {
+            int restore = std::min(spell.manaRestore, player.stats.maxMana - player.stats.mana);
+            player.stats.mana += restore;
+            log.push({CombatEventKind::SpellManaRestore, 0, playerId, playerId, CombatLog::noDetail, restore});
+        }
+        if (spell.armorIncrease > 0 || spell.magicArmorIncrease > 0) {
+            Stats wards = player.statLayers.layer(StatLayer::SpellWards);
+            wards.armor += spell.armorIncrease;
+            wards.magicArmor += spell.magicArmorIncrease;
+            player.setStatLayer(StatLayer::SpellWards, wards);
+        }
+        if (spell.armorIncrease > 0) {
+            log.push({CombatEventKind::SpellArmor, 0, playerId, playerId, CombatLog::noDetail, 0});
+        }
+        if (spell.magicArmorIncrease > 0) {
+            log.push({CombatEventKind::SpellMagicArmor, 0, playerId, playerId, CombatLog::noDetail, 0});
+        }
+        if (spell.hasDebuff) {
+            for (DebuffId debuff : names.spellDebuffs[spellId.index()]) {
+                int proc = arena.applyDebuff(target, debuff);
+                log.push({CombatEventKind::SpellDebuff, 0, playerId, targetId, debuff.value, proc});
+            }
+        }
+    }
+
+    void handleEnemyTurn(CombatSystem& combat) {
+        if (arena.aliveCount() == 0 || player.stats.hitpoints <= 0)
+            return;
+        arena.resolveWave(combat, playerC);
+        const DamageLanes& wave = arena.lastWave();
+        for (size_t i = 0; i < arena.size(); ++i) {
+            if (!arena.isAlive(i)) continue;
+            uint8_t flags = static_cast<uint8_t>((wave.crit[i] ? CombatEvent::Crit : 0) | (wave.dodge[i] ? CombatEvent::Dodge : 0));
+            log.push({CombatEventKind::Attack, flags, enemyId(i), playerId, CombatLog::noDetail, wave.total[i]});
+        }
+    }
+
+    // End of round: every combatant's debuffs deal their damage and count down in one pass.
+    void tickDebuffs() {
+        const DebuffDatabase& debuffDB = gameData().debuffs;
+        auto logFor = [this](uint16_t id) {
+            return [this, id](uint16_t debuff, int damage, bool expired) {
+                if (damage > 0) log.push({CombatEventKind::DebuffDamage, 0, id, id, debuff, damage});
+                if (expired) log.push({CombatEventKind::DebuffExpired, 0, id, id, debuff, 0});
+            };
+        };
+        if (player.stats.hitpoints > 0) {
+            player.stats.hitpoints -= player.debuffs.tick(debuffDB, logFor(playerId));
+        }
+        for (size_t i = 0; i < party.size(); ++i) {
+            party[i].stats.hitpoints -= party[i].debuffs.tick(debuffDB, logFor(partyIds[i]));
+        }
+        for (size_t i = 0; i < arena.size(); ++i) {
+            if (arena.isAlive(i)) arena.tickDebuffs(i, logFor(enemyId(i)));
+        }
+    }
+
+    void displayCombatOutcome() const {
+        if (player.stats.hitpoints <= 0) {
+            gameOut() << player.name << " has been defeated!" << endl;
+        } else if (arena.aliveCount() == 0) {
+            for (size_t i = 0; i < arena.size(); ++i) {
+                gameOut() << arena.label(i) << " has been defeated!" << endl;
+            }
+        }
+    }
+};
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "ContentSchema.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A content blob is the packed form of the data files (src/packdata.cpp builds one):
+//   header | table directory | per table: records, text records, string slots, name order, name index | strings
+// A table's hot records and its text (see ContentRow) are kept apart, as in the engine, so play
+// only ever touches the record pages. Both are stored byte for byte as the engine's own structs, with every string_view blanked
+// and listed instead as an (offset, size) slot into the string bytes. Loading maps the file
+// privately and points each string_view at its slot: no text is parsed or copied, and only the
+// record pages are written (copy-on-write). The layout is the compiler's, so a blob is rebuilt
+// whenever the game is.
+
+// Bump when a record struct or its describe() changes, so older blobs are rejected, not misread.
+constexpr uint32_t contentBlobVersion = 4;
+constexpr char contentBlobMagic[8] = {'R', 'P', 'G', 'D', 'A', 'T', 'A', '\0'};
+
+struct ContentBlobHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t tableCount;
+    uint64_t strings; // offset of the string bytes
+    uint64_t stringBytes;
+};
+
+struct ContentBlobTable {
+    uint32_t recordSize; // sizeof(Record) when written
+    uint32_t textSize;   // sizeof(Text) when written
+    uint32_t count;
+    uint32_t slotCount;
+    uint64_t records;     // Record[count]
+    uint64_t text;        // Text[count]
+    uint64_t slots;       // ContentBlobString[slotCount], in describe() order, a record's then its text's
+    uint64_t order;       // uint16_t[count], rows sorted by nameBefore
+    uint64_t sortedNames; // std::string_view[count], filled in when loaded
+};
+
+struct ContentBlobString {
+    uint32_t offset; // into the string bytes
+    uint32_t size;
+};
+
+// Packs tables into a blob image; add() them in forEachContentTable order, then save().
+class ContentBlobWriter {
+public:
+    template <class Record, class Text>
+    void add(TableView<Record> rows, TableView<Text> text, std::string_view Record::*name) {
+        static_assert(std::is_trivially_copyable<Record>::value && std::is_trivially_copyable<Text>::value,
+                      "records are stored byte for byte");
+        if (rows.size() >= 0xFFFF) throw std::length_error("content table too large for uint16_t row numbers");
+        if (text.size() != rows.size()) throw std::logic_error("content table text does not match its rows");
+
+        Table table{};
+        table.entry.recordSize = sizeof(Record);
+        table.entry.textSize = sizeof(Text);
+        table.entry.count = static_cast<uint32_t>(rows.size());
+        table.records.resize(rows.size() * sizeof(Record));
+        table.text.resize(rows.size() * sizeof(Text));
+        SlotWriter strings(*this, table.slots);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            Record record = rows[i];
+            Text recordText = text[i];
+            describe(strings, record);
+            describe(strings, recordText);
+            std::memcpy(table.records.data() + i * sizeof(Record), &record, sizeof(Record));
+            std::memcpy(table.text.data() + i * sizeof(Text), &recordText, sizeof(Text));
+        }
+        table.entry.slotCount = static_cast<uint32_t>(table.slots.size());
+
+        for (size_t i = 0; i < rows.size(); ++i) table.order.push_back(static_cast<uint16_t>(i));
+        std::stable_sort(table.order.begin(), table.order.end(),
+                         [&](uint16_t a, uint16_t b) { return nameBefore(rows[a].*name, rows[b].*name); });
+        tables.push_back(std::move(table));
+    }
+
+    void save(const string& path) {
+        auto align = [](uint64_t offset, uint64_t to) { return (offset + to - 1) / to * to; };
+        uint64_t offset = sizeof(ContentBlobHeader) + tables.size() * sizeof(ContentBlobTable);
+        for (Table& table : tables) {
+            ContentBlobTable& entry = table.entry;
+            entry.records = align(offset, alignof(std::max_align_t));
+            entry.text = align(entry.records + table.records.size(), alignof(std::max_align_t));
+            entry.slots = align(entry.text + table.text.size(), alignof(ContentBlobString));
+            entry.order = align(entry.slots + table.slots.size() * sizeof(ContentBlobString), alignof(uint16_t));
+            entry.sortedNames = align(entry.order + table.order.size() * sizeof(uint16_t), alignof(std::string_view));
+            offset = entry.sortedNames + entry.count * sizeof(std::string_view);
+        }
+
+        ContentBlobHeader header{};
+        std::memcpy(header.magic, contentBlobMagic, sizeof(header.magic));
+        header.version = contentBlobVersion;
+        header.tableCount = static_cast<uint32_t>(tables.size());
+        header.strings = offset;
+        header.stringBytes = pool.size();
+
+        std::vector<char> image(offset + pool.size(), 0);
+        std::memcpy(image.data(), &header, sizeof(header));
+        for (size_t t = 0; t < tables.size(); ++t) {
+            const Table& table = tables[t];
+            std::memcpy(image.data() + sizeof(header) + t * sizeof(ContentBlobTable), &table.entry, sizeof(ContentBlobTable));
+            std::memcpy(image.data() + table.entry.records, table.records.data(), table.records.size());
+            std::memcpy(image.data() + table.entry.text, table.text.data(), table.text.size());
+            std::memcpy(image.data() + table.entry.slots, table.slots.data(), table.slots.size() * sizeof(ContentBlobString));
+            std::memcpy(image.data() + table.entry.order, table.order.data(), table.order.size() * sizeof(uint16_t));
+        }
+        std::memcpy(image.data() + offset, pool.data(), pool.size());
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(image.data(), static_cast<std::streamsize>(image.size()));
+        if (!file) throw std::runtime_error("Cannot write content blob: " + path);
+    }
+
+private:
+    struct Table {
+        ContentBlobTable entry;
+        std::vector<char> records;
+        std::vector<char> text;
+        std::vector<ContentBlobString> slots;
+        std::vector<uint16_t> order;
+    };
+
+    // Moves each string of a record into the pool (once per distinct text) and blanks the field.
+    class SlotWriter : public ContentVisitor<SlotWriter> {
+    public:
+        SlotWriter(ContentBlobWriter& writer, std::vector<ContentBlobString>& slots) : writer(writer), slots(slots) {}
+
+        template <class T>
+        void operator()(const char*, T&) {} // numbers and enums stay in the record
+        void operator()(const char*, std::string_view& text) {
+            slots.push_back(writer.intern(text));
+            text = {};
+        }
+        template <size_t N>
+        void operator()(const char* key, FixedList<std::string_view, N>& list) {
+            for (std::string_view& text : list) (*this)(key, text);
+        }
+
+    private:
+        ContentBlobWriter& writer;
+        std::vector<ContentBlobString>& slots;
+    };
+
+    ContentBlobString intern(std::string_view text) {
+        auto found = interned.find(string(text));
+        if (found == interned.end()) {
+            found = interned.emplace(string(text), static_cast<uint32_t>(pool.size())).first;
+            pool.append(text.data(), text.size());
+        }
+        return {found->second, static_cast<uint32_t>(text.size())};
+    }
+
+    std::vector<Table> tables;
+    string pool;
+    std::map<string, uint32_t> interned;
+};
+
+// A blob mapped for the lifetime of the process; see the layout note at the top of this file.
+class ContentBlob {
+public:
+    template <class Record, class Text>
+    struct Loaded {
+        TableView<Record> rows;
+        TableView<Text> text;
+        NameLookup byName;
+    };
+
+    ContentBlob() = default;
+
+    explicit ContentBlob(const string& path) : path(path) {
+        map();
+        try {
+            if (length < sizeof(ContentBlobHeader)) fail("file too small");
+            const ContentBlobHeader& header = *reinterpret_cast<const ContentBlobHeader*>(base);
+            if (std::memcmp(header.magic, contentBlobMagic, sizeof(header.magic)) != 0) fail("not a content blob");
+            if (header.version != contentBlobVersion) fail("written by another version of the game; rebuild it with packdata");
+            checkRange(sizeof(ContentBlobHeader), header.tableCount * sizeof(ContentBlobTable));
+            checkRange(header.strings, header.stringBytes);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    ~ContentBlob() { release(); }
+
+    ContentBlob(const ContentBlob&) = delete;
+    ContentBlob& operator=(const ContentBlob&) = delete;
+    ContentBlob(ContentBlob&& other) noexcept { *this = std::move(other); }
+    ContentBlob& operator=(ContentBlob&& other) noexcept {
+        if (this != &other) {
+            release();
+            path = std::move(other.path);
+            base = std::exchange(other.base, nullptr);
+            length = std::exchange(other.length, 0);
+            buffer = std::move(other.buffer);
+        }
+        return *this;
+    }
+
+    size_t tableCount() const { return header().tableCount; }
+
+    // Fixes up table `t` in place and returns its rows, text and name index. Call once per table.
+    template <class Record, class Text>
+    Loaded<Record, Text> load(size_t t, std::string_view Record::*name) {
+        if (t >= tableCount()) fail("missing table " + std::to_string(t));
+        const ContentBlobTable& entry = reinterpret_cast<const ContentBlobTable*>(base + sizeof(ContentBlobHeader))[t];
+        if (entry.recordSize != sizeof(Record) || entry.textSize != sizeof(Text)) {
+            fail("table " + std::to_string(t) + " has a different record layout; rebuild it with packdata");
+        }
+        checkRange(entry.records, uint64_t(entry.count) * sizeof(Record), alignof(Record));
+        checkRange(entry.text, uint64_t(entry.count) * sizeof(Text), alignof(Text));
+        checkRange(entry.slots, uint64_t(entry.slotCount) * sizeof(ContentBlobString), alignof(ContentBlobString));
+        checkRange(entry.order, uint64_t(entry.count) * sizeof(uint16_t), alignof(uint16_t));
+        checkRange(entry.sortedNames, uint64_t(entry.count) * sizeof(std::string_view), alignof(std::string_view));
+
+        Record* records = reinterpret_cast<Record*>(base + entry.records);
+        Text* text = reinterpret_cast<Text*>(base + entry.text);
+        SlotReader strings(*this, reinterpret_cast<const ContentBlobString*>(base + entry.slots), entry.slotCount);
+        for (size_t i = 0; i < entry.count; ++i) {
+            describe(strings, records[i]);
+            describe(strings, text[i]);
+        }
+        if (strings.used != entry.slotCount) fail("table " + std::to_string(t) + " has unused string slots");
+
+        const uint16_t* order = reinterpret_cast<const uint16_t*>(base + entry.order);
+        std::string_view* sortedNames = reinterpret_cast<std::string_view*>(base + entry.sortedNames);
+        for (size_t k = 0; k < entry.count; ++k) {
+            if (order[k] >= entry.count) fail("table " + std::to_string(t) + " has a bad name index");
+            new (&sortedNames[k]) std::string_view(records[order[k]].*name);
+        }
+        return {TableView<Record>(records, entry.count), TableView<Text>(text, entry.count),
+                NameLookup(sortedNames, order, entry.count)};
+    }
+
+private:
+    // Points each string of a record at the next slot's text inside the mapping.
+    class SlotReader : public ContentVisitor<SlotReader> {
+    public:
+        SlotReader(const ContentBlob& blob, const ContentBlobString* slots, size_t slotCount)
+            : blob(blob), slots(slots), slotCount(slotCount) {}
+
+        template <class T>
+        void operator()(const char*, T&) {}
+        void operator()(const char*, std::string_view& text) {
+            if (used == slotCount) blob.fail("more strings than slots");
+            const ContentBlobString& slot = slots[used++];
+            if (uint64_t(slot.offset) + slot.size > blob.header().stringBytes) blob.fail("string slot out of range");
+            text = std::string_view(blob.base + blob.header().strings + slot.offset, slot.size);
+        }
+        template <size_t N>
+        void operator()(const char* key, FixedList<std::string_view, N>& list) {
+            if (list.size() > N) blob.fail("list longer than its capacity");
+            for (std::string_view& text : list) (*this)(key, text);
+        }
+
+        size_t used = 0;
+
+    private:
+        const ContentBlob& blob;
+        const ContentBlobString* slots;
+        size_t slotCount;
+    };
+
+    const ContentBlobHeader& header() const { return *reinterpret_cast<const ContentBlobHeader*>(base); }
+
+    void checkRange(uint64_t offset, uint64_t size, size_t alignment = 1) const {
+        if (offset > length || size > length - offset || offset % alignment != 0) fail("section out of range");
+    }
+
+    [[noreturn]] void fail(const string& reason) const { throw std::runtime_error("Content blob " + path + ": " + reason); }
+
+    void map() {
+#ifndef _WIN32
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) fail("cannot open");
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            fail("cannot read");
+        }
+        length = static_cast<size_t>(info.st_size);
+        void* mapped = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            length = 0;
+            fail("cannot map");
+        }
+        base = static_cast<char*>(mapped);
+#else
+        // No mmap here: read the image into one aligned buffer and fix it up the same way.
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) fail("cannot open");
+        length = static_cast<size_t>(file.tellg());
+        buffer.reset(new std::max_align_t[length / sizeof(std::max_align_t) + 1]);
+        base = reinterpret_cast<char*>(buffer.get());
+        file.seekg(0);
+        if (!file.read(base, static_cast<std::streamsize>(length))) fail("cannot read");
+#endif
+    }
+
+    void release() {
+#ifndef _WIN32
+        if (base) ::munmap(base, length);
+#endif
+        buffer.reset();
+        base = nullptr;
+        length = 0;
+    }
+
+    string path;
+    char* base = nullptr;
+    size_t length = 0;
+    std::unique_ptr<std::max_align_t[]> buffer; // Windows only
+};
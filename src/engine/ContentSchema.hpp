@@ -0,0 +1,271 @@
+#pragma once
+
+#include "Databases.hpp"
+#include "Enemy.hpp"
+
+// describe(v, record) lists every field of a content record under the key the data files use,
+// calling v(key, field) for values and v.nested(key, field) for structs inside the record. The text
+// reader and writer and the blob packer all walk records through these, so a field added to a
+// record only needs a line here (and a contentBlobVersion bump in ContentBlob.hpp). A data file
+// block is a whole ContentRow: the hot record's keys, then its text's.
+
+constexpr std::array<std::string_view, 5> locationTypeNames = {"PeacefulVillage", "PeacefulTown", "Dungeon", "Terrain", "SpellStore"};
+
+// Keeps the dotted key of the struct being visited, e.g. "stats." while inside a class's stats.
+template <class Visitor>
+class ContentVisitor {
+public:
+    template <class Struct>
+    void nested(const char* key, Struct& value) {
+        size_t length = path.size();
+        path += key;
+        path += '.';
+        describe(static_cast<Visitor&>(*this), value);
+        path.resize(length);
+    }
+
+protected:
+    string keyOf(const char* key) const { return path + key; }
+
+private:
+    string path;
+};
+
+template <class V, class Hot, class Cold>
+void describe(V& v, ContentRow<Hot, Cold>& row) {
+    describe(v, row.hot);
+    describe(v, row.cold);
+}
+
+template <class V>
+void describe(V& v, Stats& s) {
+    v("hitpoints", s.hitpoints);
+    v("maxHitpoints", s.maxHitpoints);
+    v("armor", s.armor);
+    v("magicArmor", s.magicArmor);
+    v("attack", s.attack);
+    v("magicAttack", s.magicAttack);
+    v("mana", s.mana);
+    v("maxMana", s.maxMana);
+    v("critRate", s.critRate);
+    v("critDamage", s.critDamage);
+    v("dodgeRate", s.dodgeRate);
+    v("magicAmplifierRate", s.magicAmplifierRate);
+    v("level", s.level);
+    v("expe", s.expe);
+}
+
+template <class V>
+void describe(V& v, Economy& e) {
+    v("copper", e.copper);
+}
+
+template <class V>
+void describe(V& v, PlayerClassTemplate& r) {
+    v("name", r.name);
+    v.nested("stats", r.stats);
+}
+
+template <class V>
+void describe(V& v, Lore& r) {
+    v("lore", r.description);
+}
+
+template <class V>
+void describe(V& v, PlayerRaceTemplate& r) {
+    v("name", r.name);
+    v.nested("statBonus", r.statBonus);
+}
+
+template <class V>
+void describe(V& v, RaceLore& r) {
+    v("lore", r.description);
+}
+
+template <class V>
+void describe(V& v, FoodandDrinksDatabase::FoodsandDrinksProperties& r) {
+    v("name", r.name);
+    v("type", r.type);
+    v("healthRestoration", r.healthRestoration);
+    v("maxHealthBuffBonus", r.maxHealthBuffBonus);
+    v("maxManaBuffBonus", r.maxManaBuffBonus);
+    v("manaRestoration", r.manaRestoration);
+    v("price", r.price);
+}
+
+template <class V>
+void describe(V& v, FoodandDrinksDatabase::FoodsandDrinksText& r) {
+    v("itemDesc", r.itemDesc);
+}
+
+template <class V>
+void describe(V& v, PotionDatabase::potionProperties& r) {
+    v("name", r.name);
+    v("hpEffect", r.hpEffect);
+    v("attackEffect", r.attackEffect);
+    v("defenseEffect", r.defenseEffect);
+    v("magicEffect", r.magicEffect);
+    v("manaRestore", r.manaRestore);
+    v("manaIncreaseMax", r.manaIncreaseMax);
+    v("magicDefenseEffect", r.magicDefenseEffect);
+    v("critRateEffect", r.critRateEffect);
+    v("critDamageEffect", r.critDamageEffect);
+    v("durationTurns", r.durationTurns);
+    v("price", r.price);
+}
+
+template <class V>
+void describe(V& v, PotionDatabase::potionText& r) {
+    v("effectDesc", r.effectDesc);
+}
+
+template <class V>
+void describe(V& v, EquipmentandWeaponDatabase::equipmentProperties& r) {
+    v("name", r.name);
+    v("type", r.type);
+    v("defenseIncrease", r.defenseIncrease);
+    v("magicDefenseIncrease", r.magicDefenseIncrease);
+    v("attackIncrease", r.attackIncrease);
+    v("magicAttackIncrease", r.magicAttackIncrease);
+    v("critRateIncrease", r.critRateIncrease);
+    v("critDamageIncrease", r.critDamageIncrease);
+    v("debuffChance", r.debuffChance);
+    v("price", r.price);
+}
+
+template <class V>
+void describe(V& v, EquipmentandWeaponDatabase::equipmentText& r) {
+    v("effectDesc", r.effectDesc);
+    v("debuffs", r.debuffs);
+}
+
+template <class V>
+void describe(V& v, debuffSettings::DebuffEffect& e) {
+    v("healthDecrease", e.healthDecrease);
+    v("attackDecrease", e.attackDecrease);
+    v("defenseDecrease", e.defenseDecrease);
+    v("magicAttackDecrease", e.magicAttackDecrease);
+    v("magicDefenseDecrease", e.magicDefenseDecrease);
+    v("durationTurns", e.durationTurns);
+    v("damageProc", e.damageProc);
+    v("addedTurnOnTrigger", e.addedTurnOnTrigger);
+    v("amplifierOnTrigger", e.amplifierOnTrigger);
+}
+
+template <class V>
+void describe(V& v, debuffSettings::DebuffStackRules& s) {
+    v("stackable", s.stackable);
+    v("maxStacks", s.maxStacks);
+    v("maxStackEffectName", s.maxStackEffectName);
+}
+
+template <class V>
+void describe(V& v, debuffSettings::DebuffApplication& a) {
+    v("throwable", a.throwable);
+    v("enchantOnWeapon", a.enchantOnWeapon);
+    v("nameOnEnchantment", a.nameOnEnchantment);
+    v("effectChance", a.effectChance);
+}
+
+template <class V>
+void describe(V& v, DebuffDatabase::DebuffDefinition& r) {
+    v("name", r.name);
+    v.nested("effect", r.effect);
+    v.nested("stacking", r.stacking);
+    v.nested("application", r.application);
+}
+
+template <class V>
+void describe(V& v, DebuffDatabase::DebuffText& r) {
+    v("effectDesc", r.effectDesc);
+}
+
+template <class V>
+void describe(V& v, SpellDatabase::SpellData& r) {
+    v("name", r.spellName);
+    v("manaCost", r.manaCost);
+    v("healthDamage", r.healthDamage);
+    v("manaDamage", r.manaDamage);
+    v("healthRestore", r.healthRestore);
+    v("manaRestore", r.manaRestore);
+    v("armorIncrease", r.armorIncrease);
+    v("magicArmorIncrease", r.magicArmorIncrease);
+    v("armorReduction", r.armorReduction);
+    v("magicArmorReduction", r.magicArmorReduction);
+    v("hasDebuff", r.hasDebuff);
+    v("debuffModifierOnHit", r.debuffModifierOnHit);
+    v("applicableOnStaffs", r.applicableOnStaffs);
+    v("staffBonusModifier", r.staffBonusModifier);
+    v("requiredLevel", r.requiredLevel);
+    v("price", r.price);
+}
+
+template <class V>
+void describe(V& v, SpellDatabase::SpellText& r) {
+    v("description", r.description);
+    v("debuffs", r.debuffs);
+}
+
+template <class V>
+void describe(V& v, eventDatabase::eventProperties& r) {
+    v("name", r.name);
+    v("goldReward", r.goldReward);
+    v("expReward", r.expReward);
+    v("healthEffect", r.healthEffect);
+    v("manaEffect", r.manaEffect);
+    v("enemyEncounter", r.enemyEncounter);
+    v("enemyName", r.enemyName);
+    v("enemyCount", r.enemyCount);
+}
+
+template <class V>
+void describe(V& v, eventDatabase::eventText& r) {
+    v("description", r.description);
+}
+
+template <class V>
+void describe(V& v, locationDatabase::locationProperties& r) {
+    v("name", r.name);
+    v("difficultyLevel", r.difficultyLevel);
+    v("type", r.type);
+}
+
+template <class V>
+void describe(V& v, locationDatabase::locationText& r) {
+    v("description", r.description);
+}
+
+template <class V>
+void describe(V& v, EnemyStats::StatsData& s) {
+    v("hitpoints", s.hitpoints);
+    v("maxHitpoints", s.maxHitpoints);
+    v("armor", s.armor);
+    v("magicArmor", s.magicArmor);
+    v("attack", s.attack);
+    v("magicAttack", s.magicAttack);
+    v("mana", s.mana);
+    v("maxMana", s.maxMana);
+    v("critRate", s.critRate);
+    v("critDamage", s.critDamage);
+    v("dodgeRate", s.dodgeRate);
+    v("magicAmplifierRate", s.magicAmplifierRate);
+    v("level", s.level);
+    v("expe", s.expe);
+    v.nested("economy", s.economy);
+}
+
+template <class V>
+void describe(V& v, EnemyDatabase::EnemyTemplate& r) {
+    v("name", r.name);
+    v.nested("stats", r.stats.data);
+    v("minLevel", r.minLevel);
+    v("difficultyLevel", r.difficultyLevel);
+    v("allowedLocations", r.allowedLocations);
+    v("spawnWeight", r.spawnWeight);
+}
+
+template <class V>
+void describe(V& v, EnemyDatabase::EnemyText& r) {
+    v("lore", r.lore);
+    v("debuffs", r.debuffs);
+}
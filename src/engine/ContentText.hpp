@@ -0,0 +1,230 @@
+#pragma once
+
+#include "GameData.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+// The text form of the content tables, which designers edit and packdata compiles into a blob.
+// A file holds one block of `key = value` lines per record, in table order, with blocks separated
+// by blank lines; a line starting with # is a comment. Keys are the describe() names, nested ones
+// dotted (stats.attack). Lists are comma separated, location types are written by name and money
+// is a whole number of copper (100 to the silver, see coins() in Core.hpp). A key
+// left out keeps the record's default: 0, empty, or the struct's own initializer.
+
+// Shortest text that reads back as the same float, so an export does not sprout noise digits.
+inline string formatContentFloat(float value) {
+    for (int decimals = 0; decimals <= 9; ++decimals) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(decimals) << value;
+        if (std::strtof(out.str().c_str(), nullptr) == value) return out.str();
+    }
+    std::ostringstream out;
+    out << std::setprecision(9) << value;
+    return out.str();
+}
+
+class ContentTextWriter : public ContentVisitor<ContentTextWriter> {
+public:
+    explicit ContentTextWriter(std::ostream& out) : out(out) {}
+
+    void operator()(const char* key, int& value) { line(key, std::to_string(value)); }
+    void operator()(const char* key, int64_t& value) { line(key, std::to_string(value)); }
+    void operator()(const char* key, float& value) { line(key, formatContentFloat(value)); }
+    void operator()(const char* key, bool& value) { line(key, value ? "true" : "false"); }
+    void operator()(const char* key, std::string_view& value) { line(key, string(value)); }
+    void operator()(const char* key, LocationType& value) { line(key, string(locationTypeNames[value])); }
+
+    template <class T, size_t N>
+    void operator()(const char* key, FixedList<T, N>& list) {
+        string text;
+        for (T& item : list) {
+            if (!text.empty()) text += ", ";
+            text += string(name(item));
+        }
+        line(key, text);
+    }
+
+private:
+    static std::string_view name(std::string_view text) { return text; }
+    static std::string_view name(LocationType type) { return locationTypeNames[type]; }
+
+    void line(const char* key, const string& value) {
+        out << keyOf(key) << " =" << (value.empty() ? "" : " ") << value << '\n';
+    }
+
+    std::ostream& out;
+};
+
+// Fills one record from the `key = value` lines of its block.
+class ContentTextReader : public ContentVisitor<ContentTextReader> {
+public:
+    struct Field {
+        std::string_view value;
+        int line;
+        bool used;
+    };
+
+    ContentTextReader(const string& file, std::map<string, Field>& fields) : file(file), fields(fields) {}
+
+    void operator()(const char* key, int& value) {
+        if (Field* field = find(key)) value = static_cast<int>(parseInt(*field, field->value, INT_MIN, INT_MAX));
+    }
+    void operator()(const char* key, int64_t& value) {
+        if (Field* field = find(key)) value = parseInt(*field, field->value, 0, std::numeric_limits<int64_t>::max());
+    }
+    void operator()(const char* key, float& value) {
+        if (Field* field = find(key)) value = parseFloat(*field);
+    }
+    void operator()(const char* key, bool& value) {
+        if (Field* field = find(key)) {
+            if (field->value != "true" && field->value != "false") fail(*field, "expected true or false");
+            value = field->value == "true";
+        }
+    }
+    void operator()(const char* key, std::string_view& value) {
+        if (Field* field = find(key)) value = field->value;
+    }
+    void operator()(const char* key, LocationType& value) {
+        if (Field* field = find(key)) value = parseLocation(*field, field->value);
+    }
+
+    template <class T, size_t N>
+    void operator()(const char* key, FixedList<T, N>& list) {
+        Field* field = find(key);
+        if (!field) return;
+        list = {};
+        std::string_view rest = field->value;
+        while (!rest.empty()) {
+            size_t comma = rest.find(',');
+            std::string_view item = trimContentText(rest.substr(0, comma));
+            rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+            if (item.empty()) fail(*field, "empty list entry");
+            if (list.size() == N) fail(*field, "more than " + std::to_string(N) + " entries");
+            list.push_back(parseItem<T>(*field, item));
+        }
+    }
+
+    // Throws for the first key no field of the record claimed, which is usually a typo.
+    void checkAllUsed() const {
+        for (const auto& entry : fields) {
+            if (!entry.second.used) fail(entry.second, "unknown field '" + entry.first + "'");
+        }
+    }
+
+    static std::string_view trimContentText(std::string_view text) {
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+        return text;
+    }
+
+private:
+    Field* find(const char* key) {
+        auto it = fields.find(keyOf(key));
+        if (it == fields.end()) return nullptr;
+        it->second.used = true;
+        return &it->second;
+    }
+
+    template <class T>
+    T parseItem(const Field& field, std::string_view item) const {
+        if constexpr (std::is_same<T, LocationType>::value) return parseLocation(field, item);
+        else return item;
+    }
+
+    int64_t parseInt(const Field& field, std::string_view text, int64_t min, int64_t max) const {
+        string digits(text);
+        char* end = nullptr;
+        errno = 0;
+        long long value = std::strtoll(digits.c_str(), &end, 10);
+        if (digits.empty() || *end != '\0') fail(field, "expected a whole number");
+        if (errno == ERANGE || value < min || value > max) fail(field, "number out of range");
+        return value;
+    }
+
+    float parseFloat(const Field& field) const {
+        string digits(field.value);
+        char* end = nullptr;
+        float value = std::strtof(digits.c_str(), &end);
+        if (digits.empty() || *end != '\0') fail(field, "expected a number");
+        return value;
+    }
+
+    LocationType parseLocation(const Field& field, std::string_view text) const {
+        for (size_t i = 0; i < locationTypeNames.size(); ++i) {
+            if (locationTypeNames[i] == text) return static_cast<LocationType>(i);
+        }
+        fail(field, "unknown location type '" + string(text) + "'");
+    }
+
+    [[noreturn]] void fail(const Field& field, const string& message) const {
+        throw std::runtime_error(file + ":" + std::to_string(field.line) + ": " + message);
+    }
+
+    const string& file;
+    std::map<string, Field>& fields;
+};
+
+// Reads every record of one data file, each a ContentRow for split tables. The returned views
+// point into `text`, which must outlive them.
+template <class Record>
+std::vector<Record> readContentFile(const string& path, string& text) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Cannot open data file: " + path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    text = contents.str();
+
+    std::vector<Record> records;
+    std::map<string, ContentTextReader::Field> fields;
+    auto finishRecord = [&]() {
+        if (fields.empty()) return;
+        Record record{};
+        ContentTextReader reader(path, fields);
+        describe(reader, record);
+        reader.checkAllUsed();
+        records.push_back(record);
+        fields.clear();
+    };
+
+    std::string_view rest = text;
+    for (int lineNumber = 1; !rest.empty(); ++lineNumber) {
+        size_t newline = rest.find('\n');
+        std::string_view line = ContentTextReader::trimContentText(rest.substr(0, newline));
+        rest = newline == std::string_view::npos ? std::string_view() : rest.substr(newline + 1);
+
+        if (line.empty()) {
+            finishRecord();
+            continue;
+        }
+        if (line.front() == '#') continue;
+        size_t equals = line.find('=');
+        if (equals == std::string_view::npos) {
+            throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": expected key = value");
+        }
+        string key(ContentTextReader::trimContentText(line.substr(0, equals)));
+        std::string_view value = ContentTextReader::trimContentText(line.substr(equals + 1));
+        if (!fields.emplace(key, ContentTextReader::Field{value, lineNumber, false}).second) {
+            throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": '" + key + "' given twice");
+        }
+    }
+    finishRecord();
+    return records;
+}
+
+template <class Record, class Text>
+void writeContentFile(const string& path, TableView<Record> rows, TableView<Text> text) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) throw std::runtime_error("Cannot write data file: " + path);
+    file << "# One block of `key = value` lines per record, in table order. Run packdata to rebuild the blob.\n";
+    ContentTextWriter writer(file);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        ContentRow<Record, Text> row{rows[i], text[i]};
+        file << '\n';
+        describe(writer, row);
+    }
+}
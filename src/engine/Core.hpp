@@ -0,0 +1,398 @@
+#pragma once
+
+#include "GameIO.hpp"
+#include "Ids.hpp"
+#include "Random.hpp"
+
+enum LocationType { PeacefulVillage, PeacefulTown, Dungeon, Terrain, SpellStore };
+class Player;
+
+struct Stats {
+    int hitpoints;
+    int maxHitpoints;
+    float armor;
+    float magicArmor;
+    int attack;
+    int magicAttack;
+    int mana;
+    int maxMana;
+    float critRate;
+    float critDamage;
+    float dodgeRate;
+    float magicAmplifierRate;
+    int level;
+    float expe;
+
+    void scale(float multiplier) {
+        maxHitpoints = static_cast<int>(std::round(maxHitpoints * multiplier));
+        maxMana = static_cast<int>(std::round(maxMana * multiplier));
+        hitpoints = static_cast<int>(std::round(hitpoints * multiplier));
+        hitpoints = std::min<int>(hitpoints, maxHitpoints);
+        mana = static_cast<int>(std::round(mana * multiplier));
+        mana = std::min<int>(mana, maxMana);
+        armor *= multiplier;
+        magicArmor *= multiplier;
+        attack = static_cast<int>(std::round(attack * multiplier));
+        magicAttack = static_cast<int>(std::round(magicAttack * multiplier));
+        dodgeRate *= multiplier;
+        critRate *= multiplier;
+        critDamage *= multiplier;
+        magicAmplifierRate *= multiplier;
+    }
+
+    // Adds the derived fields of `bonus`; the hitpoint and mana pools, level and experience stay.
+    void addBonus(const Stats& bonus) {
+        maxHitpoints += bonus.maxHitpoints;
+        armor += bonus.armor;
+        magicArmor += bonus.magicArmor;
+        attack += bonus.attack;
+        magicAttack += bonus.magicAttack;
+        maxMana += bonus.maxMana;
+        critRate += bonus.critRate;
+        critDamage += bonus.critDamage;
+        dodgeRate += bonus.dodgeRate;
+        magicAmplifierRate += bonus.magicAmplifierRate;
+    }
+};
+
+// Where a player's stats come from, in the order they apply. Level scales what Class and Race give
+// by 10% per level gained; every later layer is a flat bonus. Debuffs are the last layer, kept
+// in the player's DebuffSet, whose cached modifiers the combatant views subtract on read.
+enum class StatLayer { Class, Race, Level, Gear, StaffSpells, Food, Buffs, SpellWards, Count };
+
+// The layers behind Player::stats. Changing a layer only marks it dirty; resolve() then rebuilds
+// the cached result once, so combat reads plain fields and nothing is ever undone by hand.
+class StatPipeline {
+public:
+    const Stats& layer(StatLayer which) const { return layers[static_cast<size_t>(which)]; }
+    int levelsGained() const { return levels; }
+    bool isDirty() const { return dirty != 0; }
+
+    void set(StatLayer which, const Stats& bonus) {
+        layers[static_cast<size_t>(which)] = bonus;
+        dirty |= bit(which);
+    }
+
+    void setLevelsGained(int count) {
+        levels = count;
+        dirty |= bit(StatLayer::Level);
+    }
+
+    // Rebuilds the derived fields of `stats` if a layer changed, keeping its pools, level and
+    // experience; the pools are cut down to new lower maxima.
+    void resolve(Stats& stats) {
+        if (!dirty) return;
+        if (dirty & (bit(StatLayer::Class) | bit(StatLayer::Race) | bit(StatLayer::Level))) {
+            scaledBase = Stats{};
+            scaledBase.addBonus(layer(StatLayer::Class));
+            scaledBase.addBonus(layer(StatLayer::Race));
+            // One rounding step per level, matching what each level-up used to do in place.
+            for (int i = 0; i < levels; ++i) scaledBase.scale(1.1f);
+        }
+        Stats result = scaledBase;
+        for (size_t i = static_cast<size_t>(StatLayer::Gear); i < layers.size(); ++i) result.addBonus(layers[i]);
+        result.hitpoints = std::min(stats.hitpoints, result.maxHitpoints);
+        result.mana = std::min(stats.mana, result.maxMana);
+        result.level = stats.level;
+        result.expe = stats.expe;
+        stats = result;
+        dirty = 0;
+    }
+
+private:
+    static constexpr uint32_t bit(StatLayer which) { return 1u << static_cast<uint32_t>(which); }
+
+    std::array<Stats, static_cast<size_t>(StatLayer::Count)> layers{};
+    int levels = 0;
+    Stats scaledBase{}; // Class and Race after Level, reused until one of the three changes
+    uint32_t dirty = ~0u;
+};
+
+// Money is a single count of copper: 100 copper make a silver, 100 silver a gold and 100 gold a
+// platinum. Denominations only appear when an amount is written in a table (coins) or shown to
+// the player (formatCoins, Economy::toString), so adding and paying are one checked operation.
+constexpr int64_t coins(int platinum, int gold, int silver, int copper) {
+    return ((int64_t(platinum) * 100 + gold) * 100 + silver) * 100 + copper;
+}
+
+// The shortest form of a price: "1g 32s 0c", "24s 0c", "0c".
+inline string formatCoins(int64_t copper) {
+    static const char units[] = {'p', 'g', 's'};
+    static const int64_t sizes[] = {coins(1, 0, 0, 0), coins(0, 1, 0, 0), coins(0, 0, 1, 0)};
+    string text;
+    for (int i = 0; i < 3; ++i) {
+        int64_t count = copper / sizes[i];
+        if (count == 0 && text.empty()) continue;
+        text += std::to_string(count) + units[i] + ' ';
+        copper %= sizes[i];
+    }
+    return text + std::to_string(copper) + 'c';
+}
+
+struct Economy {
+    int64_t copper;
+
+    constexpr Economy() : copper(0) {}
+    constexpr Economy(int p, int g, int s, int c) : copper(coins(p, g, s, c)) {}
+
+    void addCurrency(int64_t amount) {
+        if (amount < 0) throw std::invalid_argument("addCurrency: negative amount");
+        if (copper > std::numeric_limits<int64_t>::max() - amount) throw std::overflow_error("addCurrency: purse overflow");
+        copper += amount;
+    }
+
+    // Pays `amount` if the purse holds it; otherwise leaves it untouched and returns false.
+    bool subtractCurrency(int64_t amount) {
+        if (amount < 0) throw std::invalid_argument("subtractCurrency: negative amount");
+        if (copper < amount) return false;
+        copper -= amount;
+        return true;
+    }
+
+    // Every denomination, for the purse lines: "0p 3g 12s 40c".
+    string toString() const {
+        return std::to_string(copper / coins(1, 0, 0, 0)) + "p " + std::to_string(copper / coins(0, 1, 0, 0) % 100) + "g " +
+               std::to_string(copper / coins(0, 0, 1, 0) % 100) + "s " + std::to_string(copper % 100) + "c";
+    }
+};
+
+struct Progression {
+    int level;
+    float exp;
+    int skillPoints;
+
+    Progression(int l = 1, float e = 0.0f, int sp = 0) : level(l), exp(e), skillPoints(sp) {}
+};
+
+struct Lore {
+    std::string_view description;
+    constexpr Lore(std::string_view desc = "") : description(desc) {}
+};
+
+// A view into PlayerRaceDatabase, whose text lives for the whole program; the lore stays there.
+struct PlayerRace {
+    std::string_view name;
+};
+                           
+class TimeSystem {
+public:
+    enum class TimePeriod { Morning, Afternoon, Evening, Night };
+
+    TimeSystem() : currentTurn(0), currentPeriod(TimePeriod::Morning), totalDays(0), totalWeeks(0) {}
+
+    void advanceTime(Player& player);
+
+    string getPeriodString() const {
+        switch (currentPeriod) {
+            case TimePeriod::Morning: return "Morning";
+            case TimePeriod::Afternoon: return "Afternoon";
+            case TimePeriod::Evening: return "Evening";
+            case TimePeriod::Night: return "Night";
+            default: return "Unknown";
+        }
+    }
+
+    string getFormattedTimePassed() const {
+        int daysPassed = getTotalDays();
+        if (daysPassed == 0) return "0 days";
+
+        string result;
+        int years = daysPassed / (12 * 4 * 7);
+        int remaining = daysPassed % (12 * 4 * 7);
+        int months = remaining / (4 * 7);
+        remaining %= (4 * 7);
+        int weeks = remaining / 7;
+        int days = remaining % 7;
+
+        if (years > 0) result += std::to_string(years) + " years ";
+        if (months > 0) result += std::to_string(months) + " months ";
+        if (weeks > 0) result += std::to_string(weeks) + " weeks ";
+        if (days > 0) result += std::to_string(days) + " days ";
+
+        if (!result.empty()) result.pop_back(); 
+        return result;
+    }
+
+    TimePeriod getCurrentPeriod() const {
+        return currentPeriod;
+    }
+
+    int getCurrentTurn() const {
+        return currentTurn;
+    }
+
+    int getTotalDays() const {
+        return totalDays;
+    }
+
+    int getTotalWeeks() const {
+        return totalWeeks;
+    }
+
+    void setState(int turn, TimePeriod period, int days) {
+        currentTurn = turn;
+        currentPeriod = period;
+        totalDays = days;
+        totalWeeks = totalDays / 7;
+    }
+
+private:
+    int currentTurn;
+    TimePeriod currentPeriod;
+    int totalDays;
+    int totalWeeks;
+};
+
+struct RaceLore {
+    std::string_view description;
+};
+
+// The lore of classes and races sits in PlayerClassCollection::lore and PlayerRaceDatabase::lore.
+struct PlayerRaceTemplate {
+    std::string_view name;
+    Stats statBonus; 
+};
+
+struct PlayerClassTemplate {
+    std::string_view name;
+    Stats stats;
+};
+
+class DebuffDatabase;
+
+// One active debuff on a combatant. A set holds at most one record per DebuffDatabase definition
+// (re-applying adds a stack), so it stays bounded however many procs land in a long fight.
+struct ActiveDebuff {
+    uint16_t id; // DebuffId value, i.e. the index into DebuffDatabase::getDebuffs()
+    uint8_t stacks;
+    int16_t remainingTurns;
+};
+
+// Summed stat penalties of every active debuff, kept up to date on apply and tick.
+struct DebuffModifiers {
+    int attack = 0;
+    int magicAttack = 0;
+    float armor = 0.0f;
+    float magicArmor = 0.0f;
+};
+
+// Defined in Debuffs.hpp, once DebuffDatabase is complete.
+class DebuffSet {
+public:
+    int apply(const DebuffDatabase& db, DebuffId id);
+    template <class OnEffect>
+    int tick(const DebuffDatabase& db, OnEffect&& onEffect);
+    string describe(const DebuffDatabase& db) const;
+
+    const DebuffModifiers& modifiers() const { return mods; }
+    const std::vector<ActiveDebuff>& records() const { return active; }
+    bool empty() const { return active.empty(); }
+    void clear() {
+        active.clear();
+        mods = DebuffModifiers();
+    }
+
+private:
+    void refreshModifiers(const DebuffDatabase& db);
+
+    std::vector<ActiveDebuff> active;
+    DebuffModifiers mods;
+};
+
+class Player {
+public:
+    string name;
+    Stats stats; // the resolved result of statLayers; change the layers, never the derived fields
+    StatPipeline statLayers;
+    Economy economy;
+    Progression progression;
+    PlayerRace race;
+    PlayerClassTemplate playerClass;
+    TimeSystem timeSystem;
+    DebuffSet debuffs;
+    std::vector<DebuffId> equippedWeaponDebuffs;
+    float equippedWeaponDebuffChance = 0.0f;
+    LocationType currentLocationType;
+    string currentLocation;
+    std::vector<SpellId> learnedSpells;
+    std::vector<SpellId> equippedStaffSpells;
+    bool sleptToday = false;
+    std::set<EnemyId> defeatedEnemies;
+    std::set<LocationId> discoveredLocations;
+    std::set<EquipmentId> boughtWeapons;
+    std::set<string> hiredSpecialCharacters;
+    std::set<EventId> encounteredEvents;
+    bool hasNewDictionaryEntry = false;
+
+    Player(const string& n,const PlayerRace& r,const PlayerClassTemplate& pc): name(n), race(r), playerClass(pc), timeSystem(), currentLocationType(Terrain), currentLocation("Abandoned Cell") {
+        stats = pc.stats; 
+        statLayers.set(StatLayer::Class, pc.stats);
+        statLayers.resolve(stats);
+        economy = Economy();
+        progression = Progression();
+    }
+
+    // A race adds to the pools and to the hitpoint, mana, armor and attack fields only.
+    void applyRaceBonus(const Stats& bonus) {
+        Stats race{};
+        race.maxHitpoints = bonus.maxHitpoints;
+        race.armor = bonus.armor;
+        race.magicArmor = bonus.magicArmor;
+        race.attack = bonus.attack;
+        race.magicAttack = bonus.magicAttack;
+        race.maxMana = bonus.maxMana;
+        stats.hitpoints += bonus.hitpoints;
+        stats.mana += bonus.mana;
+        setStatLayer(StatLayer::Race, race);
+    }
+
+    void setStatLayer(StatLayer which, const Stats& bonus) {
+        statLayers.set(which, bonus);
+        statLayers.resolve(stats);
+    }
+
+    // Scales the class and race stats by another 10%, and the current pools with them.
+    void gainLevel() {
+        const float multiplier = 1.1f;
+        stats.hitpoints = static_cast<int>(std::round(stats.hitpoints * multiplier));
+        stats.mana = static_cast<int>(std::round(stats.mana * multiplier));
+        statLayers.setLevelsGained(statLayers.levelsGained() + 1);
+        statLayers.resolve(stats);
+    }
+};
+
+inline void TimeSystem::advanceTime(Player& player) {
+    currentTurn++;
+    switch (currentPeriod) {
+        case TimePeriod::Morning:
+            currentPeriod = TimePeriod::Afternoon;
+            break;
+        case TimePeriod::Afternoon:
+            currentPeriod = TimePeriod::Evening;
+            break;
+        case TimePeriod::Evening:
+            currentPeriod = TimePeriod::Night;
+            break;
+        case TimePeriod::Night:
+            currentPeriod = TimePeriod::Morning;
+            totalDays++;
+            totalWeeks = totalDays / 7;
+        
+            if (!player.sleptToday) {
+                int penalty = static_cast<int>(std::round(player.stats.maxHitpoints * 0.05f));
+                player.stats.hitpoints -= penalty;
+                if (player.stats.hitpoints < 1) player.stats.hitpoints = 1;
+                gameOut() << "[!] Your vision blurs. The shadows of 'The Lands Between' seem longer than usual." << endl;
+            }
+
+            player.sleptToday = false;
+            break;
+    }
+}
+
+inline Player createPlayer(const string& name, const PlayerRaceTemplate& race, const PlayerClassTemplate& playerClass) {
+    PlayerRace playerRace{ race.name };
+    Player hero(name, playerRace, playerClass);
+    hero.applyRaceBonus(race.statBonus);
+    return hero;
+}
@@ -0,0 +1,816 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Tables.hpp"
+
+class PlayerClassCollection {
+public:
+    using Row = ContentRow<PlayerClassTemplate, Lore>;
+    static constexpr auto builtinRows = tableOf<Row>({
+            {"Warrior", {75, 75, 0.05f, 0.02f, 8, 2, 10, 10, 0.05f, 1.5f, 0.05f, 1.0f, 1, 0.0f},
+             {"Strong and resilient melee fighter, excels at absorbing damage."}},
+            {"Knight", {70, 70, 0.08f, 0.03f, 10, 2, 8, 8, 0.04f, 1.4f, 0.05f, 1.0f, 1, 0.0f},
+             {"Heavily armored, balanced between defense and offense."}},
+            {"Berserker", {80, 80, 0.04f, 0.02f, 7, 2, 6, 6, 0.03f, 1.3f, 0.05f, 1.0f, 1, 0.0f},
+             {"Frenzied melee attacker with high hitpoints and raw power."}},
+
+            {"Assassin", {55, 55, 0.02f, 0.01f, 8, 2, 6, 6, 1.0f, 100.0f, 1.0f, 1.0f, 1, 0.0f},
+             {"Agile and deadly, specializes in critical strikes."}},
+            {"Rogue", {60, 60, 0.02f, 0.01f, 7, 2, 8, 8, 0.2f, 1.8f, 0.1f, 1.0f, 1, 0.0f},
+             {"Stealthy fighter with high dexterity and precision."}},
+            {"Ranger", {50, 50, 0.01f, 0.01f, 5, 4, 10, 10, 0.3f, 1.7f, 0.1f, 1.0f, 1, 0.0f},
+             {"Skilled marksman, excels at ranged attacks and high crits."}},
+
+            {"Mage", {45, 45, 0.01f, 0.05f, 2, 9, 18, 18, 0.05f, 1.5f, 0.05f, 1.2f, 1, 0.0f},
+             {"Master of arcane arts, high magic attack and mana pool."}},
+            {"Sorcerer", {40, 40, 0.01f, 0.07f, 2, 11, 22, 22, 0.05f, 1.5f, 0.05f, 1.3f, 1, 0.0f},
+             {"Specialist in destructive spells, fragile but powerful."}},
+            {"Scholar", {50, 50, 0.02f, 0.05f, 3, 7, 14, 14, 0.05f, 1.5f, 0.05f, 1.1f, 1, 0.0f},
+             {"Versatile magic user, balanced between offense and defense."}},
+
+            {"Shrewd Diplomat", {60, 60, 0.02f, 0.03f, 5, 4, 14, 14, 0.05f, 1.5f, 0.05f, 1.0f, 1, 0.0f},
+             {"Uses wit and charm to outsmart opponents, prefers diplomacy over fighting."}},
+            {"Travelling Merchant", {65, 65, 0.03f, 0.02f, 3, 2, 10, 10, 0.05f, 1.5f, 0.05f, 1.0f, 1, 0.0f},
+             {"Journeys across lands trading goods, can defend himself when needed."}},
+            {"Sheltered Noble", {55, 55, 0.02f, 0.05f, 3, 2, 10, 10, 0.05f, 1.5f, 0.05f, 1.0f, 1, 0.0f},
+             {"Raised in comfort, trained in etiquette and light combat."}},
+            {"Prisoner", {50, 50, 0.01f, 0.01f, 2, 2, 6, 6, 0.05f, 1.2f, 0.05f, 1.0f, 1, 0.0f},
+             {"Imprisoned for unknown reasons, weak but resilient in spirit."}}
+    });
+    static constexpr auto builtinTemplates = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinLore = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinTemplates, &PlayerClassTemplate::name);
+
+    TableView<PlayerClassTemplate> templates = builtinTemplates;
+    TableView<Lore> lore = builtinLore; // row for row with templates
+    NameLookup byName = builtinIndex.lookup();
+
+    // Points the table at rows loaded from a content blob.
+    void load(TableView<PlayerClassTemplate> rows, TableView<Lore> text, NameLookup index) {
+        templates = rows;
+        lore = text;
+        byName = index;
+    }
+
+    const PlayerClassTemplate& getClassTemplate(std::string_view className) const {
+        size_t index = byName.find(className);
+        if (index != NameLookup::none) return templates[index];
+        throw std::runtime_error("Class template not found: " + string(className));
+    }
+};
+
+struct PlayerRaceDatabase {
+    using Row = ContentRow<PlayerRaceTemplate, RaceLore>;
+    static constexpr auto builtinRows = tableOf<Row>({
+        
+            { "Human", {5, 5, 0.025f, 0.025f, 1, 1, 2, 2, 0, 0, 0, 0, 1, 0.0f},
+                {"Humans are versatile and resilient, gaining a slight boost to all stats."} },
+            { "Noble", {4, 4, 0.025f, 0.025f, 1, 1, 2, 2, 0, 0, 0, 0, 1, 0.0f},
+                {"Nobles are trained in etiquette and combat, slightly higher attack and mana."} },
+            { "Commoner", {6, 6, 0.02f, 0.02f, 0, 0, 2, 2, 0, 0, 0, 0, 1, 0.0f},
+                {"Commoners are hardy but less trained in combat, slightly higher hitpoints."} },
+
+        
+            { "Elf", {0, 0, 0.0f, 0.05f, 2, 5, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"Elves are agile and magically attuned, gaining bonus magic attack and magic armor."} },
+            { "High Elf", {0, 0, 0.0f, 0.06f, 3, 6, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"High Elves are elite magic users, with enhanced magic abilities."} },
+            { "Wood Elf", {0, 0, 0.0f, 0.04f, 2, 4, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"Wood Elves are skilled hunters and scouts, with increased agility and stealth."} },
+
+            { "Dark Elf", {2, 2, 0.0f, 0.075f, 3, 6, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"Dark Elves are exiled elves who dwell in shadows and forbidden lands, mistrusted by other races."} },
+
+           
+            { "Orc", {15, 15, 0.075f, 0.0f, 5, 0, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"Orcs are strong, aggressive warriors often hunted or outlawed by human and elf societies."} },
+            { "Reptilian", {15, 15, 0.075f, 0.0f, 5, 0, 0, 0, 0, 0, 0, 0, 1, 0.0f},
+                {"Reptilians are predatory creatures, often hunted by human and elf societies."} }
+    });
+    static constexpr auto builtinTemplates = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinLore = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinTemplates, &PlayerRaceTemplate::name);
+
+    TableView<PlayerRaceTemplate> templates = builtinTemplates;
+    TableView<RaceLore> lore = builtinLore; // row for row with templates
+    NameLookup byName = builtinIndex.lookup();
+
+    // Points the table at rows loaded from a content blob.
+    void load(TableView<PlayerRaceTemplate> rows, TableView<RaceLore> text, NameLookup index) {
+        templates = rows;
+        lore = text;
+        byName = index;
+    }
+};
+
+class FoodandDrinksDatabase{
+    public:
+    struct FoodsandDrinksProperties{
+            std::string_view name;
+            std::string_view type;
+            int healthRestoration;
+            int maxHealthBuffBonus;
+            int maxManaBuffBonus;
+            int manaRestoration;
+
+            int64_t price; // copper
+        };
+    struct FoodsandDrinksText {
+        std::string_view itemDesc;
+    };
+
+        const auto& getFoodAndDrink() const {
+            return FoodandDrinkMenu;
+        }
+        const auto& getFoodAndDrinkText() const {
+            return FoodandDrinkText;
+        }
+
+        NameLookup byName = builtinIndex.lookup();
+
+        // Points the table at rows loaded from a content blob.
+        void load(TableView<FoodsandDrinksProperties> rows, TableView<FoodsandDrinksText> text, NameLookup index) {
+            FoodandDrinkMenu = rows;
+            FoodandDrinkText = text;
+            byName = index;
+        }
+    private:
+    using Row = ContentRow<FoodsandDrinksProperties, FoodsandDrinksText>;
+    static constexpr auto builtinRows = tableOf<Row>({
+        // Foods
+        {"Bread", "Food", 20, 0, 0, 0, coins(0, 0, 1, 0), "A loaf of bread that restores some health."},
+        {"Apple", "Food", 25, 0, 0, 0, coins(0, 0, 1, 50), "A fresh apple that restores health."},
+        {"Cheese", "Food", 30, 0, 0, 0, coins(0, 0, 2, 0), "A piece of cheese that restores health."},
+        // Dishes
+        {"Meat Stew", "Dish", 50, 5, 0, 0, coins(0, 0, 5, 0), "A hearty stew that restores health and boosts max HP."},
+        {"Grilled Fish", "Dish", 45, 3, 0, 0, coins(0, 0, 6, 0), "Grilled fish that restores health."},
+        {"Vegetable Soup", "Dish", 40, 2, 0, 0, coins(0, 0, 4, 50), "Nutritious soup that restores health."},
+        {"Roasted Meat", "Dish", 60, 7, 0, 0, coins(0, 0, 8, 0), "Roasted meat that greatly restores health."},
+        {"Salad", "Dish", 35, 1, 0, 0, coins(0, 0, 3, 50), "A fresh salad that restores health."},
+        // Drinks
+        {"Water", "Drink", 0, 0, 0, 10, coins(0, 0, 0, 50), "Clean water that restores mana."},
+        {"Milk", "Drink", 0, 0, 0, 15, coins(0, 0, 1, 0), "Fresh milk that restores mana."},
+        {"Wine", "Drink", 0, 0, 0, 20, coins(0, 0, 3, 0), "A glass of wine that restores mana."},
+        {"Beer", "Drink", 0, 0, 0, 18, coins(0, 0, 2, 50), "A mug of beer that restores mana."},
+        {"Juice", "Drink", 0, 0, 0, 12, coins(0, 0, 1, 50), "Fruit juice that restores mana."}
+    });
+    static constexpr auto builtinMenu = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinMenuText = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinMenu, &FoodsandDrinksProperties::name);
+    TableView<FoodsandDrinksProperties> FoodandDrinkMenu = builtinMenu;
+    TableView<FoodsandDrinksText> FoodandDrinkText = builtinMenuText;
+};
+
+class PotionDatabase {
+    public:
+        struct potionProperties{
+            std::string_view name;
+            int hpEffect;
+            int attackEffect;
+            int defenseEffect;
+            int magicEffect;
+            int manaRestore;
+            int manaIncreaseMax;
+            int magicDefenseEffect;
+            float critRateEffect;
+            float critDamageEffect;
+            int durationTurns;
+            int64_t price; // copper
+        };
+        struct potionText {
+            std::string_view effectDesc;
+        };
+
+        const auto& getPotions() const {
+            return potionList;
+        }
+        const auto& getPotionText() const {
+            return potionTextList;
+        }
+
+        NameLookup byName = builtinIndex.lookup();
+
+        // Points the table at rows loaded from a content blob.
+        void load(TableView<potionProperties> rows, TableView<potionText> text, NameLookup index) {
+            potionList = rows;
+            potionTextList = text;
+            byName = index;
+        }
+
+    private:
+        using Row = ContentRow<potionProperties, potionText>;
+        static constexpr auto builtinRows = tableOf<Row>({
+        { "Small Health Potion", 50, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 0, coins(0, 0, 12, 0), "Restores 50 HP" },
+        { "Large Health Potion", 150, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 0, coins(0, 0, 36, 0), "Restores 150 HP" },
+        { "Extra Large Health Potion", 300, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 0, coins(0, 0, 72, 0), "Restores 300 HP" },
+        { "Small Mana Potion", 0, 0, 0, 0, 15, 5, 0, 0.0f, 0.0f, 3, coins(0, 0, 24, 0), "Restores 15 Mana for 3 turns" },
+        { "Large Mana Potion", 0, 0, 0, 0, 40, 10, 0, 0.0f, 0.0f, 3, coins(0, 0, 60, 0), "Restores 40 Mana for 3 turns" },
+        { "Extra Large Mana Potion", 0, 0, 0, 0, 80, 20, 0, 0.0f, 0.0f, 3, coins(0, 0, 120, 0), "Restores 80 Mana for 3 turns" },
+        { "Strength Potion", 0, 10, 0, 0, 0, 0, 0, 0.0f, 0.0f, 3, coins(0, 0, 30, 0), "Increases Attack by 10 for 3 turns" },
+        { "Defense Potion", 0, 0, 5, 0, 0, 0, 0, 0.0f, 0.0f, 3, coins(0, 0, 30, 0), "Increases Defense by 5 for 3 turns" },
+        { "Magic Elixir", 0, 0, 0, 15, 20, 10, 0, 0.0f, 0.0f, 3, coins(0, 0, 48, 0), "Increases Magic Attack by 15 and restores 20 Mana for 3 turns" },
+        { "Rage Potion", 0, 0, 0, 0, 0, 0, 0, 0.1f, 0.5f, 3, coins(0, 0, 96, 0), "Increases Crit Rate by 10% and Crit Damage by 50% for 3 turns" },
+        { "Wrath Potion", 0, 0, 0, 0, 0, 0, 0, 0.15f, 0.75f, 3, coins(0, 0, 108, 0), "Increases Crit Rate by 15% and Crit Damage by 75% for 3 turns" },
+        { "Speed Potion", 0, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 3, coins(0, 0, 42, 0), "Increases Dodge Rate by 20% for 3 turns" },
+        { "Regeneration Potion", 20, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 5, coins(0, 0, 84, 0), "Restores 20 HP per turn for 5 turns" },
+        { "Invisibility Potion", 0, 0, 0, 0, 0, 0, 0, 0.0f, 0.0f, 2, coins(0, 0, 150, 0), "Increases Dodge Rate by 50% for 2 turns" }
+    });
+        static constexpr auto builtinPotions = columnOf(builtinRows, &Row::hot);
+        static constexpr auto builtinPotionText = columnOf(builtinRows, &Row::cold);
+        static constexpr auto builtinIndex = indexByName(builtinPotions, &potionProperties::name);
+        TableView<potionProperties> potionList = builtinPotions;
+        TableView<potionText> potionTextList = builtinPotionText;
+};
+
+class EquipmentandWeaponDatabase {
+    public:
+        struct equipmentProperties{
+            std::string_view name;
+            std::string_view type;
+            int defenseIncrease;
+            int magicDefenseIncrease;
+            int attackIncrease;
+            int magicAttackIncrease;
+            float critRateIncrease;
+            float critDamageIncrease;
+            float debuffChance;
+            int64_t price; // copper
+        };
+        struct equipmentText {
+            std::string_view effectDesc;
+            FixedList<std::string_view, 3> debuffs;
+        };
+
+        const auto& getEquipment() const {
+            return equipmentList;
+        }
+        const auto& getEquipmentText() const {
+            return equipmentTextList;
+        }
+
+        NameLookup byName = builtinIndex.lookup();
+
+        // Points the table at rows loaded from a content blob.
+        void load(TableView<equipmentProperties> rows, TableView<equipmentText> text, NameLookup index) {
+            equipmentList = rows;
+            equipmentTextList = text;
+            byName = index;
+        }
+
+    private:
+    using Row = ContentRow<equipmentProperties, equipmentText>;
+    static constexpr auto builtinRows = tableOf<Row>({
+        { "Leather Armor", "Armor", 5, 0, 0, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 24, 0), "Increases Defense by 5", {} },
+        { "Reinforced Leather Armor", "Armor", 7, 0, 0, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 36, 0), "Increases Defense by 7", {} },
+        { "Iron Armor", "Armor", 10, 0, 0, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 60, 0), "Increases Defense by 10", {} },
+        { "Chainmail", "Armor", 12, 0, 0, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 72, 0), "Increases Defense by 12", {} },
+        { "Steel Armor", "Armor", 15, 0, 0, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 108, 0), "Increases Defense by 15", {} },
+        { "Steel Sword", "Weapon", 0, 0, 22, 0, 0.0f, 0.0f, 0.3f, coins(0, 0, 132, 0), "Increases Attack by 22, 30% chance to apply Burning debuff.", {"Burning"} },
+        { "Wooden Sword", "Weapon", 0, 0, 8, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 36, 0), "Increases Attack by 8", {} },
+        { "Iron Sword", "Weapon", 0, 0, 15, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 90, 0), "Increases Attack by 15", {} },
+        { "Dagger", "Weapon", 0, 0, 5, 0, 0.1f, 1.8f, 0.0f, coins(0, 0, 72, 0), "Increases Attack by 5, Crit Rate by 10%, Crit Damage by 80%", {} },
+        { "Enchanted Dagger", "Weapon", 0, 0, 8, 0, 0.15f, 2.0f, 0.0f, coins(0, 0, 126, 0), "Increases Attack by 8, Crit Rate by 15%, Crit Damage by 100%", {} },
+        { "Magic Staff", "Staff", 0, 22, 0, 22, 0.0f, 0.0f, 0.0f, coins(0, 1, 32, 0), "Increases Magic Attack by 22", {} },
+        { "Wooden Staff", "Staff", 0, 0, 0, 8, 0.0f, 0.0f, 0.0f, coins(0, 0, 36, 0), "Increases Magic Attack by 8", {} },
+        { "Iron Staff", "Staff", 0, 0, 0, 15, 0.0f, 0.0f, 0.0f, coins(0, 0, 90, 0), "Increases Magic Attack by 15", {} },
+        { "Greatsword", "Weapon", 0, 0, 20, 0, 0.0f, 0.0f, 0.0f, coins(0, 1, 20, 0), "Increases Attack by 20", {} },
+        { "Mace", "Weapon", 0, 0, 12, 0, 0.0f, 0.0f, 0.2f, coins(0, 0, 72, 0), "Increases Attack by 12, 20% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Battle Axe", "Weapon", 0, 0, 16, 0, 0.0f, 0.0f, 0.25f, coins(0, 0, 96, 0), "Increases Attack by 16, 25% chance to apply Bleeding debuff.", {"Bleeding"} },
+        { "Longsword", "Weapon", 0, 0, 18, 0, 0.05f, 0.0f, 0.0f, coins(0, 0, 108, 0), "Increases Attack by 18, slight Crit Rate bonus.", {} },
+        { "Rapier", "Weapon", 0, 0, 12, 0, 0.15f, 2.0f, 0.0f, coins(0, 0, 84, 0), "Increases Attack by 12, high Crit Rate and Damage.", {} },
+        { "War Hammer", "Weapon", 0, 0, 20, 0, 0.0f, 0.0f, 0.3f, coins(0, 0, 120, 0), "Increases Attack by 20, 30% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Halberd", "Weapon", 0, 0, 24, 0, 0.0f, 0.0f, 0.0f, coins(0, 1, 0, 0), "Increases Attack by 24, powerful polearm.", {} },
+        { "Crossbow", "Weapon", 0, 0, 14, 0, 0.1f, 1.5f, 0.0f, coins(0, 0, 90, 0), "Increases Attack by 14, ranged weapon with Crit bonuses.", {} },
+        { "Morning Star", "Weapon", 0, 0, 17, 0, 0.0f, 0.0f, 0.35f, coins(0, 0, 102, 0), "Increases Attack by 17, 35% chance to apply Bleeding debuff.", {"Bleeding"} },
+        { "Katana", "Weapon", 0, 0, 19, 0, 0.08f, 1.8f, 0.0f, coins(0, 0, 114, 0), "Increases Attack by 19, balanced Crit stats.", {} },
+        { "Flail", "Weapon", 0, 0, 15, 0, 0.0f, 0.0f, 0.4f, coins(0, 0, 90, 0), "Increases Attack by 15, 40% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Spear", "Weapon", 0, 0, 13, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 78, 0), "Increases Attack by 13, versatile polearm.", {} },
+        { "Bow", "Weapon", 0, 0, 11, 0, 0.12f, 1.6f, 0.0f, coins(0, 0, 66, 0), "Increases Attack by 11, ranged with good Crit stats.", {} },
+        { "Scimitar", "Weapon", 0, 0, 14, 0, 0.06f, 1.4f, 0.0f, coins(0, 0, 84, 0), "Increases Attack by 14, curved blade with Crit bonuses.", {} },
+        { "Claymore", "Weapon", 0, 0, 22, 0, 0.0f, 0.0f, 0.0f, coins(0, 1, 20, 0), "Increases Attack by 22, heavy two-handed sword.", {} },
+        { "Falchion", "Weapon", 0, 0, 16, 0, 0.04f, 1.2f, 0.0f, coins(0, 0, 96, 0), "Increases Attack by 16, slashing weapon with Crit.", {} },
+        { "Pike", "Weapon", 0, 0, 18, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 108, 0), "Increases Attack by 18, long reach polearm.", {} },
+        { "Throwing Knives", "Weapon", 0, 0, 8, 0, 0.2f, 2.5f, 0.15f, coins(0, 0, 48, 0), "Increases Attack by 8, high Crit, 15% chance Bleeding.", {"Bleeding"} },
+        { "Mace", "Weapon", 0, 0, 12, 0, 0.0f, 0.0f, 0.2f, coins(0, 0, 72, 0), "Increases Attack by 12, 20% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Battle Axe", "Weapon", 0, 0, 16, 0, 0.0f, 0.0f, 0.25f, coins(0, 0, 96, 0), "Increases Attack by 16, 25% chance to apply Bleeding debuff.", {"Bleeding"} },
+        { "Longsword", "Weapon", 0, 0, 18, 0, 0.05f, 0.0f, 0.0f, coins(0, 0, 108, 0), "Increases Attack by 18, slight Crit Rate bonus.", {} },
+        { "Rapier", "Weapon", 0, 0, 12, 0, 0.15f, 2.0f, 0.0f, coins(0, 0, 84, 0), "Increases Attack by 12, high Crit Rate and Damage.", {} },
+        { "War Hammer", "Weapon", 0, 0, 20, 0, 0.0f, 0.0f, 0.3f, coins(0, 0, 120, 0), "Increases Attack by 20, 30% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Halberd", "Weapon", 0, 0, 24, 0, 0.0f, 0.0f, 0.0f, coins(0, 1, 0, 0), "Increases Attack by 24, powerful polearm.", {} },
+        { "Crossbow", "Weapon", 0, 0, 14, 0, 0.1f, 1.5f, 0.0f, coins(0, 0, 90, 0), "Increases Attack by 14, ranged weapon with Crit bonuses.", {} },
+        { "Morning Star", "Weapon", 0, 0, 17, 0, 0.0f, 0.0f, 0.35f, coins(0, 0, 102, 0), "Increases Attack by 17, 35% chance to apply Bleeding debuff.", {"Bleeding"} },
+        { "Katana", "Weapon", 0, 0, 19, 0, 0.08f, 1.8f, 0.0f, coins(0, 0, 114, 0), "Increases Attack by 19, balanced Crit stats.", {} },
+        { "Flail", "Weapon", 0, 0, 15, 0, 0.0f, 0.0f, 0.4f, coins(0, 0, 90, 0), "Increases Attack by 15, 40% chance to apply Weakness debuff.", {"Weakness"} },
+        { "Spear", "Weapon", 0, 0, 13, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 78, 0), "Increases Attack by 13, versatile polearm.", {} },
+        { "Bow", "Weapon", 0, 0, 11, 0, 0.12f, 1.6f, 0.0f, coins(0, 0, 66, 0), "Increases Attack by 11, ranged with good Crit stats.", {} },
+        { "Scimitar", "Weapon", 0, 0, 14, 0, 0.06f, 1.4f, 0.0f, coins(0, 0, 84, 0), "Increases Attack by 14, curved blade with Crit bonuses.", {} },
+        { "Claymore", "Weapon", 0, 0, 22, 0, 0.0f, 0.0f, 0.0f, coins(0, 1, 20, 0), "Increases Attack by 22, heavy two-handed sword.", {} },
+        { "Falchion", "Weapon", 0, 0, 16, 0, 0.04f, 1.2f, 0.0f, coins(0, 0, 96, 0), "Increases Attack by 16, slashing weapon with Crit.", {} },
+        { "Pike", "Weapon", 0, 0, 18, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 108, 0), "Increases Attack by 18, long reach polearm.", {} },
+        { "Throwing Knives", "Weapon", 0, 0, 8, 0, 0.2f, 2.5f, 0.15f, coins(0, 0, 48, 0), "Increases Attack by 8, high Crit, 15% chance Bleeding.", {"Bleeding"} },
+        { "Quarterstaff", "Weapon", 0, 0, 10, 0, 0.0f, 0.0f, 0.0f, coins(0, 0, 60, 0), "Increases Attack by 10, simple but effective.", {} }
+    });
+    static constexpr auto builtinEquipment = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinEquipmentText = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinEquipment, &equipmentProperties::name);
+    TableView<equipmentProperties> equipmentList = builtinEquipment;
+    TableView<equipmentText> equipmentTextList = builtinEquipmentText;
+};
+
+namespace debuffSettings{
+    struct DebuffEffect {
+        int healthDecrease = 0;
+        int attackDecrease = 0;
+        int defenseDecrease = 0;
+        int magicAttackDecrease = 0;
+        int magicDefenseDecrease = 0;
+
+        int durationTurns = 0;
+        int damageProc = 0;             
+        int addedTurnOnTrigger = 0;              
+        float amplifierOnTrigger = 1.0f; 
+    };
+    
+    struct DebuffStackRules {
+        bool stackable = false;
+        int maxStacks = 1;
+        std::string_view maxStackEffectName; 
+    };
+    
+    struct DebuffApplication {
+        bool throwable = false;
+        bool enchantOnWeapon = false; 
+        std::string_view nameOnEnchantment;
+        float effectChance = 1.0f; 
+    };
+};
+class DebuffDatabase{
+    public:
+    struct DebuffDefinition {
+        std::string_view name;
+        debuffSettings::DebuffEffect effect;
+        debuffSettings::DebuffStackRules stacking;
+        debuffSettings::DebuffApplication application;
+    };
+    struct DebuffText {
+        std::string_view effectDesc;
+    };
+    const auto& getDebuffs() const {
+        return debuffList;
+    }
+    const auto& getDebuffText() const {
+        return debuffTextList;
+    }
+
+    NameLookup byName = builtinIndex.lookup();
+
+    // Points the table at rows loaded from a content blob.
+    void load(TableView<DebuffDefinition> rows, TableView<DebuffText> text, NameLookup index) {
+        debuffList = rows;
+        debuffTextList = text;
+        byName = index;
+    }
+
+    // Index of the named definition, or -1.
+    int find(std::string_view name) const {
+        size_t index = byName.find(name);
+        return index == NameLookup::none ? -1 : static_cast<int>(index);
+    }
+    private:
+        using Row = ContentRow<DebuffDefinition, DebuffText>;
+        static constexpr auto builtinRows = tableOf<Row>({
+           
+             {"Burning",
+            {10, 0, 0, 0, 0, 3, 5, 0, 1.0f},   // healthDecrease, attackDecrease, defenseDecrease, magicAttackDecrease, magicDefenseDecrease, durationTurns, damageProc, addedTurnOnTrigger, amplifierOnTrigger
+            {true, 5, "Scorched"},              // stackable, maxStacks, maxStackEffectName
+            {true, true, "Fire Aspect", 0.3f}, // throwable, enchantOnWeapon, nameOnEnchantment, effectChance
+            "Deals 10 damage over 3 turns."
+        },
+
+  
+        {"Freeze",
+            {0, 0, 0, 0, 0, 3, 0, 2, 1.2f},    
+            {true, 6, "Frostbite"},
+            {true, true, "Frost Aspect", 1.0f},
+            "Freezes the target, slowing them and dealing frost damage over time."
+        },
+
+       
+        {"Poison",
+            {5, 0, 0, 0, 0, 3, 0, 2, 1.3f},  
+            {true, 6, "Envenomed"},
+            {true, true, "Poisoned", 1.0f},
+            "Poisons the target, dealing damage over time and stacking poison effects."
+        },
+
+       
+        {"Bleeding",
+            {5, 0, 0, 0, 0, 0, 0, 0, 2.0f}, 
+            {true, 8, "Hemorrhage"},
+            {true, true, "Vampiric", 1.0f},
+            "Causes severe bleeding over time, dealing high damage and may heal the attacker."
+        },
+
+
+        {"Weakness",
+            {0, 5, 0, 0, 0, 3, 0, 0, 1.0f},
+            {true, 3, "Enfeebled"},
+            {true, true, "Weakening Strike", 1.0f},
+            "Reduces the target's attack temporarily."
+        },
+
+        {"Vulnerability",
+            {0, 0, 0, 0, 0, 3, 0, 0, 1.0f}, 
+            {true, 3, "Exposed"},
+            {true, true, "Crippling Strike", 1.0f},
+            "Makes the target more vulnerable, increasing damage taken."
+        },
+
+        {"Magic Dampening",
+            {0, 0, 0, 5, 0, 3, 0, 0, 1.0f},
+            {true, 3, "Arcane Suppressed"},
+            {true, true, "Nullifying Strike", 1.0f},
+            "Reduces the target's magic damage output."
+        },
+
+        {"Mana Weakness",
+            {0, 0, 0, 0, 0, 3, 10, 0, 1.0f}, 
+            {true, 3, "Mana Starved"},
+            {true, true, "Mana Drain", 1.0f},
+            "Reduces the target's mana and ability to cast spells."
+        },
+
+        {"Health Blight",
+            {0, 0, 0, 0, 0, 3, 0, 0, 1.5f}, 
+            {true, 3, "Blighted"},
+            {true, true, "Blight Enchantment", 1.0f},
+            "Reduces the target's max HP and increases all incoming damage."
+        },
+
+        {"Armor Break",
+            {0, 0, 5, 0, 0, 3, 0, 0, 1.0f},
+            {true, 3, "Shattered"},
+            {false, false, "", 1.0f},
+            "Cracks the target's armor, lowering its defense."
+        },
+
+        {"Shock",
+            {0, 0, 0, 0, 5, 2, 0, 0, 1.0f},
+            {true, 3, "Overcharged"},
+            {false, false, "", 1.0f},
+            "Lingering lightning that lowers the target's magic defense."
+        }
+    });
+        static constexpr auto builtinDebuffs = columnOf(builtinRows, &Row::hot);
+        static constexpr auto builtinDebuffText = columnOf(builtinRows, &Row::cold);
+        static constexpr auto builtinIndex = indexByName(builtinDebuffs, &DebuffDefinition::name);
+        TableView<DebuffDefinition> debuffList = builtinDebuffs;
+        TableView<DebuffText> debuffTextList = builtinDebuffText;
+};
+class SpellDatabase {
+public:
+struct SpellData {
+        std::string_view spellName;
+
+        int manaCost;
+
+        // Damage
+        int healthDamage;
+        int manaDamage;
+
+        // Restoration
+        int healthRestore;
+        int manaRestore;
+
+        // Buffs
+        float armorIncrease;
+        float magicArmorIncrease;
+
+        // Debuffs
+        float armorReduction;
+        float magicArmorReduction;
+
+        bool hasDebuff;
+        float debuffModifierOnHit;
+
+        // Weapon interaction
+        bool applicableOnStaffs;
+        float staffBonusModifier;
+
+        int requiredLevel;
+        int64_t price; // copper
+    };
+struct SpellText {
+    std::string_view description;
+    FixedList<std::string_view, 3> debuffs;
+};
+
+    const auto& getSpells() const {
+        return spellsList;
+    }
+    const auto& getSpellText() const {
+        return spellTextList;
+    }
+
+    NameLookup byName = builtinIndex.lookup();
+
+    // Points the table at rows loaded from a content blob.
+    void load(TableView<SpellData> rows, TableView<SpellText> text, NameLookup index) {
+        spellsList = rows;
+        spellTextList = text;
+        byName = index;
+    }
+
+private:
+    using Row = ContentRow<SpellData, SpellText>;
+    static constexpr auto builtinRows = tableOf<Row>({
+        {
+            "Glintstone Pebble", 10,
+            22, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            false, 0.0f,
+            true, 1.15f,
+            1,
+            coins(0, 0, 50, 0),
+            "Fires a shard of glintstone magic at the enemy.", {}
+        },
+        {
+            "Rock Sling", 14,
+            28, 0,
+            0, 0,
+            0.0f, 0.0f,
+            5.0f, 0.0f,
+            true, 1.0f,
+            false, 1.0f,
+            2,
+            coins(0, 0, 50, 0),
+            "Hurls boulders that stagger and weaken armor.", {"Armor Break"}
+        },
+        {
+            "Flame Sling", 12,
+            20, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            true, 1.0f,
+            false, 1.0f,
+            1,
+            coins(0, 0, 50, 0),
+            "Launches fire that scorches enemies over time.", {"Burning"}
+        },
+        {
+            "Lightning Spear", 18,
+            32, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 5.0f,
+            true, 1.0f,
+            false, 1.0f,
+            3,
+            coins(0, 0, 50, 0),
+            "Conjures a spear of lightning that pierces foes.", {"Shock"}
+        },
+        {
+            "Urgent Heal", 14,
+            0, 0,
+            40, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            false, 0.0f,
+            false, 1.0f,
+            1,
+            coins(0, 0, 50, 0),
+            "Quickly restores health in moments of danger.", {}
+        },
+        {
+            "Flame, Grant Me Strength", 22,
+            0, 0,
+            0, 0,
+            8.0f, 4.0f,
+            0.0f, 0.0f,
+            false, 0.0f,
+            false, 1.0f,
+            4,
+            coins(0, 0, 50, 0),
+            "Bolsters the body with flame, increasing defenses.", {}
+        },
+        {
+            "Comet Azur", 30,
+            45, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 8.0f,
+            true, 1.2f,
+            true, 1.25f,
+            6,
+            coins(0, 0, 50, 0),
+            "Unleashes a devastating torrent of magic.", {"Freeze"}
+        },
+        {
+            "Stars of Ruin", 38,
+            50, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            true, 1.0f,
+            true, 1.2f,
+            7,
+            coins(0, 0, 50, 0),
+            "Summons homing stars that relentlessly pursue foes.", {"Burning"}
+        },
+        {
+            "Fireball", 20,
+            38, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            true, 1.0f,
+            false, 1.0f,
+            2,
+            coins(0, 0, 50, 0),
+            "Hurls a blazing fireball that explodes on impact.", {"Burning"}
+        },
+        {
+            "Greater Heal", 28,
+            0, 0,
+            85, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            false, 0.0f,
+            false, 1.0f,
+            5,
+            coins(0, 0, 50, 0),
+            "A powerful incantation that restores great vitality.", {}
+        },
+        {
+            "Frost Nova", 24,
+            18, 0,
+            0, 0,
+            0.0f, 0.0f,
+            0.0f, 0.0f,
+            true, 1.0f,
+            false, 1.0f,
+            4,
+            coins(0, 0, 50, 0),
+            "Releases a wave of frost that freezes nearby enemies.", {"Freeze"}
+        }
+    });
+    static constexpr auto builtinSpells = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinSpellText = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinSpells, &SpellData::spellName);
+    TableView<SpellData> spellsList = builtinSpells;
+    TableView<SpellText> spellTextList = builtinSpellText;
+};
+
+class eventDatabase{
+    public:
+        struct eventProperties{
+            std::string_view name;
+            int goldReward;
+            int expReward;
+            int healthEffect;
+            int manaEffect;
+            bool enemyEncounter;
+            std::string_view enemyName;
+            int enemyCount;
+
+        };
+        struct eventText {
+            std::string_view description;
+        };
+        const auto& getEvents() const {
+            return eventList;
+        }
+        const auto& getEventText() const {
+            return eventTextList;
+        }
+
+        NameLookup byName = builtinIndex.lookup();
+
+        // Points the table at rows loaded from a content blob.
+        void load(TableView<eventProperties> rows, TableView<eventText> text, NameLookup index) {
+            eventList = rows;
+            eventTextList = text;
+            byName = index;
+        }
+    private:
+        using Row = ContentRow<eventProperties, eventText>;
+        static constexpr auto builtinRows = tableOf<Row>({
+            { "Find Treasure", 100, 50, 0, 0, false, "", 1, "You stumble upon a hidden treasure chest."},
+            { "Ambushed by Bandits", -50, -20, -10, 0, true, "Cutpurse", 3, "You are ambushed by a group of bandits!"},
+            { "Mysterious Fountain", 0, 0, 30, 20, false, "", 1, "You find a mysterious fountain that restores your health and mana."},
+            { "Ambushed by Goblins", 0, 0, 0, 0, true, "Goblin Marauder", 2, "You are ambushed by a group of goblins!"},
+            { "Cursed Artifact", 0, 100, -20, 0, false, "", 1, "You discover a cursed artifact that grants power but drains your life force."},
+            { "Ghostly Encounter", 0, 75, 0, 0, false, "", 1, "A restless spirit appears, sharing tales of the past and granting wisdom."},
+            { "Dark Ritual Site", 0, 50, 0, -15, false, "", 1, "You find a site of dark rituals. Participating grants forbidden knowledge but at a cost."},
+            { "Undead Ambush", 0, 0, 0, 0, true, "Ancient Remains", 2, "Skeletal warriors rise from the earth, their bones clattering in the night."},
+            { "Mysterious Traveler", 25, 25, 0, 0, false, "", 1, "A hooded figure offers a cryptic warning and a small reward for your caution."},
+            { "Ancient Ruin", 0, 40, -10, 0, false, "", 1, "Exploring an ancient ruin reveals forgotten lore, but triggers a trap."},
+            { "Plague Village", 0, 0, -25, 0, false, "", 1, "A village afflicted by a mysterious plague; you catch a glimpse of the horror."},
+            { "Dark Blessing", 0, 60, -5, 10, false, "", 1, "A shadowy entity blesses you with dark power, enhancing your abilities at a hidden cost."},
+            { "Merchant Caravan", 50, 0, 0, 0, false, "", 1, "You encounter a merchant caravan willing to trade."},
+            { "Healing Spring", 0, 0, 50, 0, false, "", 1, "You find a natural spring that heals your wounds."},
+            { "Mana Crystal", 0, 0, 0, 50, false, "", 1, "A glowing crystal restores your magical energy."},
+            { "Bandit Camp", 0, 0, 0, 0, true, "Highwayman", 2, "You stumble upon a bandit camp!"},
+            { "Lost Adventurer", 30, 30, 0, 0, false, "", 1, "A lost adventurer shares their story and rewards you."},
+            { "Cursed Forest", 0, 0, -15, -10, false, "", 1, "The forest's curse saps your strength."},
+            { "Treasure Map", 75, 25, 0, 0, false, "", 1, "You find an old map leading to hidden treasure."},
+            { "Wandering Spirit", 0, 50, 0, 0, false, "", 1, "A spirit guides you, granting insight."},
+            { "Ruined Temple", 0, 30, 0, -20, false, "", 1, "Exploring a temple drains your mana but reveals secrets."},
+            { "Dragon Sighting", 0, 0, 0, 0, true, "Dragon Hatchling", 1, "A dragon appears, ready for battle!"},
+            { "Ancient Ruins Trap", 0, 0, -20, 0, false, "", 1, "You trigger a trap in ancient ruins."},
+            { "Friendly Merchant", 50, 25, 0, 0, false, "", 1, "A merchant offers you a discount."},
+            { "Healing Herbs", 0, 0, 40, 0, false, "", 1, "You find healing herbs."},
+            { "Mana Crystal Vein", 0, 0, 0, 60, false, "", 1, "You discover a vein of mana crystals."},
+            { "Bandit Ambush", 0, 0, 0, 0, true, "Highwayman", 3, "Bandits ambush you!"},
+            { "Lost Artifact", 0, 80, 0, 0, false, "", 1, "You find a lost artifact granting power."},
+            { "Poisonous Mist", 0, 0, -30, -20, false, "", 1, "A poisonous mist surrounds you."},
+            { "Treasure Map Clue", 75, 30, 0, 0, false, "", 1, "You find a clue to a treasure map."},
+            { "Wandering Healer", 0, 0, 100, 0, false, "", 1, "A healer offers to restore your health."},
+            { "Shadow Creature", 0, 0, 0, 0, true, "Shadow Fiend", 1, "A shadow creature attacks!"}
+        });
+        static constexpr auto builtinEvents = columnOf(builtinRows, &Row::hot);
+        static constexpr auto builtinEventText = columnOf(builtinRows, &Row::cold);
+        static constexpr auto builtinIndex = indexByName(builtinEvents, &eventProperties::name);
+        TableView<eventProperties> eventList = builtinEvents;
+        TableView<eventText> eventTextList = builtinEventText;
+};
+
+class locationDatabase{                                                                                                                                                                                                                                                                                                                                                                                                                  
+    public:
+        struct locationProperties{
+            std::string_view name;
+            int difficultyLevel;
+            LocationType type;
+        };
+        struct locationText {
+            std::string_view description;
+        };
+        const auto& getLocations() const {
+            return locationList;
+        }
+        const auto& getLocationText() const {
+            return locationTextList;
+        }
+
+        NameLookup byName = builtinIndex.lookup();
+
+        // Points the table at rows loaded from a content blob.
+        void load(TableView<locationProperties> rows, TableView<locationText> text, NameLookup index) {
+            locationList = rows;
+            locationTextList = text;
+            byName = index;
+        }
+    private:
+        using Row = ContentRow<locationProperties, locationText>;
+        static constexpr auto builtinRows = tableOf<Row>({
+            {"Enchanted Forest", 2, Terrain, "A mystical forest filled with magical creatures."},
+            {"Abandoned Castle", 4, Dungeon, "An old castle rumored to be haunted by ghosts."},
+            {"Dark Caves", 5, Terrain, "A network of dark caves inhabited by dangerous monsters."},
+            {"Abyssal Dungeon", 4, Dungeon, "A deep dungeon descending into the abyss, filled with demonic horrors."},
+            {"Barren Plains", 1, Terrain, "Vast, desolate plains where the wind carries the screams of the damned."},
+            {"Eldritch Forest", 2, Terrain, "A twisted forest where ancient evils lurk among gnarled trees."},
+            {"Murky Swamp", 3, Terrain, "A foul swamp teeming with undead and poisonous mists."},
+            {"Volcanic Wasteland", 6, Terrain, "A scorching land of lava and fire, home to fiery beasts."},
+            {"Frozen Tundra", 3, Terrain, "An icy expanse where blizzards rage and ice monsters roam."},
+            {"Poisoned Marshes", 4, Terrain, "A toxic bog filled with venomous creatures and deadly fumes."},
+            {"Dragon's Lair", 7, Dungeon, "A cavernous lair where a mighty dragon guards its hoard."},
+            {"Necromancer's Tower", 5, Dungeon, "A towering spire where undead minions are raised."},
+            {"Haunted Ruins", 3, Dungeon, "Ancient ruins cursed with spirits and traps."},
+            {"Shadowed Grove", 2, Terrain, "A dark grove where shadows come alive."},
+            {"Cursed Citadel", 6, Dungeon, "A fortress overrun by demonic forces."},
+            {"Wailing Caves", 4, Terrain, "Caves echoing with the cries of tormented souls."},
+            {"Infernal Pit", 8, Dungeon, "A bottomless pit leading to hellish realms."},
+            {"Peaceful Village", 1, PeacefulVillage, "A quiet village where people live in harmony."},
+            {"Peaceful Town", 1, PeacefulTown, "A bustling modest town."},
+            {"Witch Hut", 1, SpellStore, "A mysterious hut where a witch sells spells."},
+            {"Enchanted Library", 3, Dungeon, "A library filled with ancient tomes and magical knowledge."},
+            {"Forgotten Cemetery", 3, Terrain, "An overgrown graveyard where restless spirits roam."},
+            {"Bloodstained Battlefield", 4, Terrain, "A scarred field littered with the remnants of ancient wars."},
+            {"Mystic Ruins", 5, Dungeon, "Crumbling ruins infused with arcane energy and hidden secrets."},
+            {"Crystal Caverns", 4, Terrain, "Glistening caves filled with crystal formations and echoing magic."},
+            {"Thunderstorm Peaks", 6, Terrain, "Jagged mountains where lightning storms rage eternally."},
+            {"Whispering Woods", 3, Terrain, "A forest where trees seem to whisper secrets and illusions abound."},
+            {"Plague Lands", 5, Terrain, "A blighted region where disease and decay reign supreme."},
+            {"Bandit Hideout", 3, Dungeon, "A hidden camp where outlaws plot their next raids."},
+            {"Underwater Temple", 7, Dungeon, "A submerged sanctuary guarded by aquatic horrors."},
+            {"Floating Islands", 5, Terrain, "Islands suspended in the sky, home to aerial creatures."},
+            {"Desert Oasis", 2, Terrain, "A lush paradise in the midst of endless sands, hiding ancient treasures."},
+            {"Lava Fields", 6, Terrain, "Fields of molten rock where fire elementals dance."},
+            {"Ice Palace", 5, Dungeon, "A grand palace of ice, ruled by frost queens."},
+            {"Ghost Town", 2, Terrain, "An abandoned settlement haunted by the echoes of its past inhabitants."},
+            {"Arcane Academy", 3, SpellStore, "A prestigious school of magic, filled with aspiring sorcerers."},
+            {"Pirate Cove", 4, Dungeon, "A hidden cove where pirates hoard their ill-gotten gains."},
+            {"Eternal Flame Volcano", 7, Terrain, "A volcano with an unquenchable fire at its heart."},
+            {"Moonlit Glade", 2, Terrain, "A serene clearing bathed in eternal moonlight, home to fey creatures."},
+            {"Abyssal Trench", 8, Terrain, "A deep oceanic trench where eldritch horrors dwell."},
+
+        });
+        static constexpr auto builtinLocations = columnOf(builtinRows, &Row::hot);
+        static constexpr auto builtinLocationText = columnOf(builtinRows, &Row::cold);
+        static constexpr auto builtinIndex = indexByName(builtinLocations, &locationProperties::name);
+        TableView<locationProperties> locationList = builtinLocations;
+        TableView<locationText> locationTextList = builtinLocationText;
+};
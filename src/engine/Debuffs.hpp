@@ -0,0 +1,89 @@
+#pragma once
+
+#include "GameData.hpp"
+
+// Tick rules, all read from DebuffDatabase:
+//  - applying deals damageProc once; re-applying adds a stack (up to maxStacks when stackable) and
+//    extends the duration by addedTurnOnTrigger, or refreshes it when that is 0
+//  - every round deals healthDecrease per stack, times amplifierOnTrigger once the debuff has hit
+//    its stack cap (Burning becomes Scorched), then counts down; durationTurns 0 lasts one round
+//  - attack/defense decreases are per stack; defense values are percentage points of armor
+
+inline bool debuffCapped(const DebuffDatabase::DebuffDefinition& def, const ActiveDebuff& debuff) {
+    return def.stacking.stackable && def.stacking.maxStacks > 1 && debuff.stacks >= def.stacking.maxStacks;
+}
+
+inline int debuffTickDamage(const DebuffDatabase::DebuffDefinition& def, const ActiveDebuff& debuff) {
+    if (def.effect.healthDecrease <= 0) return 0;
+    float damage = static_cast<float>(def.effect.healthDecrease * debuff.stacks);
+    if (debuffCapped(def, debuff)) damage *= def.effect.amplifierOnTrigger;
+    return static_cast<int>(std::round(damage));
+}
+
+inline int DebuffSet::apply(const DebuffDatabase& db, DebuffId id) {
+    const auto& def = db.getDebuffs()[id.index()];
+    const int duration = std::max(1, def.effect.durationTurns);
+
+    auto it = std::find_if(active.begin(), active.end(), [&](const ActiveDebuff& d) { return d.id == id.value; });
+    if (it == active.end()) {
+        active.push_back({id.value, 1, static_cast<int16_t>(duration)});
+    } else {
+        if (def.stacking.stackable && it->stacks < std::min(def.stacking.maxStacks, int(UINT8_MAX))) it->stacks++;
+        if (def.effect.addedTurnOnTrigger > 0) {
+            const int longest = duration + def.effect.addedTurnOnTrigger * std::max(1, def.stacking.maxStacks);
+            it->remainingTurns = static_cast<int16_t>(std::min(longest, it->remainingTurns + def.effect.addedTurnOnTrigger));
+        } else {
+            it->remainingTurns = static_cast<int16_t>(std::max<int>(it->remainingTurns, duration));
+        }
+    }
+    refreshModifiers(db);
+    return std::max(0, def.effect.damageProc);
+}
+
+// One pass over the set: reports (id, damage, expired) for every record, drops the expired ones
+// in place and returns the total damage for the caller to subtract.
+template <class OnEffect>
+int DebuffSet::tick(const DebuffDatabase& db, OnEffect&& onEffect) {
+    if (active.empty()) return 0;
+    const auto& defs = db.getDebuffs();
+    int total = 0;
+    size_t kept = 0;
+    for (size_t i = 0; i < active.size(); ++i) {
+        ActiveDebuff debuff = active[i];
+        const int damage = debuffTickDamage(defs[debuff.id], debuff);
+        debuff.remainingTurns--;
+        const bool expired = debuff.remainingTurns <= 0;
+        onEffect(debuff.id, damage, expired);
+        total += damage;
+        if (!expired) active[kept++] = debuff;
+    }
+    if (kept != active.size()) {
+        active.resize(kept);
+        refreshModifiers(db);
+    }
+    return total;
+}
+
+inline void DebuffSet::refreshModifiers(const DebuffDatabase& db) {
+    mods = DebuffModifiers();
+    for (const auto& debuff : active) {
+        const auto& effect = db.getDebuffs()[debuff.id].effect;
+        mods.attack += effect.attackDecrease * debuff.stacks;
+        mods.magicAttack += effect.magicAttackDecrease * debuff.stacks;
+        mods.armor += effect.defenseDecrease * debuff.stacks / 100.0f;
+        mods.magicArmor += effect.magicDefenseDecrease * debuff.stacks / 100.0f;
+    }
+}
+
+// e.g. "Burning x3 (2) Scorched (4)": stack count when above one, turns left in brackets.
+inline string DebuffSet::describe(const DebuffDatabase& db) const {
+    string text;
+    for (const auto& debuff : active) {
+        const auto& def = db.getDebuffs()[debuff.id];
+        bool capped = debuffCapped(def, debuff) && !def.stacking.maxStackEffectName.empty();
+        text += capped ? def.stacking.maxStackEffectName : def.name;
+        if (!capped && debuff.stacks > 1) text += " x" + std::to_string(debuff.stacks);
+        text += " (" + std::to_string(debuff.remainingTurns) + ") ";
+    }
+    return text;
+}
@@ -0,0 +1,382 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Tables.hpp"
+
+struct EnemyStats {
+    struct StatsData {
+        int hitpoints;
+        int maxHitpoints;
+        float armor;
+        float magicArmor;
+        int attack;
+        int magicAttack;
+        int mana;
+        int maxMana;
+        float critRate;
+        float critDamage;
+        float dodgeRate;
+        float magicAmplifierRate;
+        int level;
+        float expe;
+        Economy economy;
+    } data;
+
+    bool scaled = false;
+
+    void scale(float multiplier) {
+        data.maxHitpoints = static_cast<int>(std::round(data.maxHitpoints * multiplier));
+        data.maxMana = static_cast<int>(std::round(data.maxMana * multiplier));
+        data.hitpoints = static_cast<int>(std::round(data.hitpoints * multiplier));
+        data.hitpoints = std::min<int>(data.hitpoints, data.maxHitpoints);
+        data.mana = static_cast<int>(std::round(data.mana * multiplier));
+        data.mana = std::min<int>(data.mana, data.maxMana);
+        data.armor *= multiplier;
+        data.magicArmor *= multiplier;
+        data.attack = static_cast<int>(std::round(data.attack * multiplier));
+        data.magicAttack = static_cast<int>(std::round(data.magicAttack * multiplier));
+        data.dodgeRate *= multiplier;
+        data.critRate *= multiplier;
+        data.critDamage *= multiplier;
+        data.magicAmplifierRate *= multiplier;
+    }
+};
+
+struct Enemy {
+    EnemyId id; // template index
+    EnemyStats stats;
+    DebuffSet debuffs; // active on this enemy; the template's debuff list is not applied at spawn
+
+    std::string_view name() const; // defined in Names.hpp
+};
+
+// Outside EnemyDatabase so the spawnWeight default is complete before the built-in table below
+// is built from it.
+struct EnemyTemplate {
+    std::string_view name;
+    EnemyStats stats;
+    int minLevel;
+    int difficultyLevel;
+    FixedList<LocationType, 5> allowedLocations;
+    float spawnWeight = 1.0f; // relative to the other templates that can spawn in the same place; 0 never spawns
+};
+
+struct EnemyDatabase {
+    using EnemyTemplate = ::EnemyTemplate;
+    // Read by the dictionary and by packdata's checks, never while spawning or fighting.
+    struct EnemyText {
+        std::string_view lore;
+        FixedList<std::string_view, 3> debuffs;
+    };
+    using Row = ContentRow<EnemyTemplate, EnemyText>;
+    static constexpr auto builtinRows = tableOf<Row>({
+    // FORMAT: NAME, HP, ARMOR, MAGIC ARMOR, ATTACK, MAGIC ATTACK, MANA, MAXMANA, CRITRATE, CRITDAMAGE, EVASIONRATE, MAGICAMPLIFIERRATE, LEVEL, EXP, GOLD, MINLEVEL, DIFFICULTYLEVEL, ALLOWEDLOCATIONS, SPAWNWEIGHT, LORE, DEBUFFS
+
+        { "Ooze",
+          {{50, 50, 0.02f, 0.02f, 5, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 10, Economy(0,0,0,70)}},
+          1, 1, {Terrain, Dungeon}, 1.0f,
+          "A pulsating ooze, a corrupted mass of slime that dissolves flesh on contact.", {} },
+
+        { "Cutpurse",
+          {{45, 45, 0.02f, 0.02f, 4, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 8, Economy(0,5,0,0)}},
+          1, 1, {PeacefulVillage, PeacefulTown, Terrain}, 1.0f,
+          "A sly cutpurse, lurking in alleys, stealing not just gold but life essence.", {} },
+        { "Rat Swarm",
+          {{40, 40, 0.01f, 0.01f, 4, 0, 0, 0, 0.0f, 1.4f, 0.05f, 1.0f, 1, 6, Economy(0,0,2,40)}},
+          1, 1, {Terrain, Dungeon}, 1.0f,
+          "A mass of diseased rats scurrying as one, gnawing anything in their path.", {"Poison"} },
+
+        { "Broken Skeleton",
+          {{55, 55, 0.03f, 0.05f, 6, 1, 0, 0, 0.0f, 1.4f, 0.0f, 1.0f, 1, 14, Economy(0,0,8,20)}},
+          1, 1, {Dungeon}, 1.0f,
+          "A poorly animated skeleton barely held together by dark magic.", {} },
+
+        { "Wolf",
+          {{72, 72, 0.08f, 0.04f, 10, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 24, Economy(0,0,10,30)}},
+          1, 2, {Terrain}, 1.0f,
+          "Wolves are fierce predators that hunt in packs, their eyes glowing with feral hunger.", {} },
+
+        { "Serpent",
+          {{60, 60, 0.03f, 0.03f, 7, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 12, Economy(0,0,5,10)}},
+          1, 2, {Terrain}, 1.0f,
+          "A venomous serpent, coiled in shadows, striking with deadly precision.", {"Poison"} },
+
+        { "Carrion Bird",
+          {{55, 55, 0.02f, 0.02f, 6, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 11, Economy(0,0,15,10)}},
+          1, 2, {Terrain}, 1.0f,
+          "A scavenging carrion bird, feasting on the dead, its talons dripping with decay.", {} },
+        { "Wild Boar",
+          {{80, 80, 0.07f, 0.02f, 11, 0, 0, 0, 0.0f, 1.4f, 0.0f, 1.0f, 1, 26, Economy(0,0,15,40)}},
+          1, 2, {Terrain}, 1.0f,
+          "A raging boar that charges without fear, fueled by primal rage.", {} },
+
+        { "Goblin Scout",
+          {{58, 58, 0.04f, 0.03f, 7, 0, 0, 0, 0.05f, 1.5f, 0.05f, 1.0f, 1, 18, Economy(0,0,20,25)}},
+          1, 2, {PeacefulVillage, Terrain}, 1.0f,
+          "A nimble goblin scout, observing prey before calling reinforcements.", {} },
+
+
+        { "Goblin Marauder",
+          {{64, 64, 0.08f, 0.04f, 8, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 16, Economy(0,0,30,50)}},
+          1, 3, {PeacefulTown, Terrain, Dungeon}, 1.0f,
+          "Goblin marauders are savage raiders, pillaging villages under the cover of darkness.", {} },
+
+        { "Highwayman",
+          {{65, 65, 0.05f, 0.02f, 8, 0, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 15, Economy(0,1,50,0)}},
+          1, 3, {PeacefulTown, Terrain}, 1.0f,
+          "A ruthless highwayman, ambushing travelers on cursed roads for their souls.", {} },
+
+        { "Ancient Remains",
+          {{56, 56, 0.04f, 0.08f, 6, 2, 0, 0, 0.0f, 1.5f, 0.0f, 1.0f, 1, 20, Economy(0,0,5,30)}},
+          1, 3, {Terrain, Dungeon}, 1.0f,
+          "Ancient remains are cursed bones of forgotten warriors, animated by dark sorcery.", {} },
+
+
+        { "Wraith",
+          {{60, 60, 0.02f, 0.10f, 4, 12, 0, 0, 0.05f, 1.6f, 0.1f, 1.2f, 2, 30, Economy(0,0,20,50)}},
+          2, 4, {Dungeon, Terrain}, 1.0f,
+          "A spectral entity, a tormented soul bound to the mortal realm.", {"Freeze"} },
+
+        { "Ghoul",
+          {{85, 85, 0.05f, 0.03f, 12, 2, 0, 0, 0.03f, 1.4f, 0.05f, 1.0f, 2, 35, Economy(0,0,25,75)}},
+          2, 4, {Dungeon, Terrain}, 1.0f,
+          "A rotting undead creature, driven by insatiable hunger.", {"Poison"} },
+          
+
+
+        { "Specter",
+          {{50, 50, 0.01f, 0.12f, 3, 15, 0, 0, 0.1f, 1.8f, 0.15f, 1.3f, 3, 40, Economy(0,0,30,0)}},
+          3, 5, {Dungeon, Terrain}, 1.0f,
+          "A ghostly apparition, fading in and out of reality.", {"Magic Dampening"} },
+
+        { "Vampire",
+          {{90, 90, 0.06f, 0.08f, 8, 8, 0, 0, 0.08f, 1.7f, 0.1f, 1.2f, 5, 60, Economy(0,1,50,0)}},
+          5, 5, {Dungeon}, 1.0f,
+          "An immortal blood-drinker, elegant yet deadly.", {"Bleeding"} },
+
+        { "Demon",
+          {{100, 100, 0.08f, 0.06f, 10, 10, 0, 0, 0.05f, 1.5f, 0.05f, 1.1f, 4, 50, Economy(0,1,0,0)}},
+          4, 6, {Dungeon}, 1.0f,
+          "A fiendish being from the abyssal depths.", {"Burning"} },
+
+        { "Lich",
+          {{70, 70, 0.03f, 0.15f, 5, 20, 0, 0, 0.05f, 1.6f, 0.05f, 1.4f, 6, 75, Economy(0,2,0,0)}},
+          6, 6, {Dungeon}, 1.0f,
+          "A powerful necromancer who cheated death.", {"Mana Weakness"} },
+
+        { "Fire Elemental",
+          {{80, 80, 0.05f, 0.05f, 5, 15, 0, 0, 0.05f, 1.5f, 0.05f, 1.2f, 6, 80, Economy(0,0,50,0)}},
+          6, 6, {Terrain}, 1.0f,
+          "A fiery elemental born from volcanic flames, wielding destructive fire magic.", {"Burning"} },
+
+        { "Ice Wraith",
+          {{60, 60, 0.02f, 0.08f, 4, 10, 0, 0, 0.1f, 1.6f, 0.1f, 1.3f, 3, 45, Economy(0,0,30,0)}},
+          3, 3, {Terrain}, 1.0f,
+          "A spectral being of ice, haunting frozen wastes.", {"Freeze"} },
+
+        { "Swamp Beast",
+          {{90, 90, 0.08f, 0.04f, 12, 0, 0, 0, 0.03f, 1.4f, 0.02f, 1.0f, 4, 55, Economy(0,0,40,50)}},
+          4, 4, {Terrain}, 1.0f,
+          "A monstrous creature lurking in murky swamps, dripping with venom.", {"Poison"} },
+
+        { "Cave Troll",
+          {{120, 120, 0.1f, 0.02f, 14, 0, 0, 0, 0.02f, 1.3f, 0.01f, 1.0f, 5, 70, Economy(0,0,60,0)}},
+          5, 5, {Dungeon, Terrain}, 1.0f,
+          "A hulking troll dwelling in dark caves, smashing intruders with brute force.", {} },
+
+        { "Necrotic Zombie",
+          {{75, 75, 0.06f, 0.06f, 8, 0, 0, 0, 0.0f, 1.2f, 0.0f, 1.0f, 3, 40, Economy(0,0,25,25)}},
+          3, 3, {Dungeon, Terrain}, 1.0f,
+          "A reanimated corpse infused with necrotic energy, spreading decay.", {"Poison"} },
+
+        { "Shadow Fiend",
+          {{55, 55, 0.01f, 0.12f, 3, 12, 0, 0, 0.15f, 1.8f, 0.2f, 1.4f, 4, 60, Economy(0,0,35,0)}},
+          4, 4, {Dungeon}, 1.0f,
+          "A shadowy demon that drains magic and hides in darkness.", {"Magic Dampening"} },
+
+        { "Volcanic Golem",
+          {{150, 150, 0.12f, 0.08f, 16, 8, 0, 0, 0.01f, 1.2f, 0.0f, 1.1f, 7, 100, Economy(0,1,0,0)}},
+          7, 7, {Dungeon, Terrain}, 1.0f,
+          "A massive golem forged from volcanic rock, radiating intense heat.", {"Burning"} },
+
+        { "Frost Giant",
+          {{140, 140, 0.1f, 0.05f, 18, 0, 0, 0, 0.04f, 1.4f, 0.03f, 1.0f, 6, 90, Economy(0,0,80,0)}},
+          6, 6, {Terrain}, 1.0f,
+          "A colossal giant from icy realms, wielding freezing winds.", {"Freeze"} },
+
+        { "Plague Bearer",
+          {{70, 70, 0.04f, 0.04f, 6, 4, 0, 0, 0.05f, 1.5f, 0.05f, 1.1f, 4, 50, Economy(0,0,45,0)}},
+          4, 4, {Terrain}, 1.0f,
+          "A plague-ridden harbinger, spreading disease and despair.", {"Poison"} },
+
+        { "Dragon Hatchling",
+          {{100, 100, 0.08f, 0.1f, 10, 12, 0, 0, 0.08f, 1.7f, 0.1f, 1.3f, 8, 120, Economy(0,2,0,0)}},
+          8, 8, {Dungeon}, 1.0f,
+          "A young dragon, fierce and powerful, guarding its territory.", {"Burning"} },
+
+        { "Swamp Troll",
+          {{140, 140, 0.12f, 0.04f, 16, 2, 0, 0, 0.02f, 1.3f, 0.01f, 1.0f, 6, 95, Economy(0,0,70,0)}},
+          6, 6, {Terrain}, 1.0f,
+          "A hulking troll from the swamps, covered in muck and wielding a massive club.", {"Poison"} },
+
+        { "Forest Spirit",
+          {{60, 60, 0.02f, 0.08f, 4, 10, 0, 0, 0.1f, 1.6f, 0.15f, 1.2f, 4, 55, Economy(0,0,40,0)}},
+          4, 4, {Terrain}, 1.0f,
+          "A ethereal spirit of the forest, weaving magic and illusions.", {"Freeze"} },
+
+        { "Mountain Giant",
+          {{160, 160, 0.15f, 0.05f, 20, 0, 0, 0, 0.01f, 1.2f, 0.0f, 1.0f, 7, 110, Economy(0,1,0,0)}},
+          7, 7, {Terrain}, 1.0f,
+          "A colossal giant dwelling in the mountains, hurling boulders at intruders.", {} },
+
+        { "Desert Scorpion",
+          {{70, 70, 0.04f, 0.04f, 8, 0, 0, 0, 0.05f, 1.5f, 0.05f, 1.1f, 3, 50, Economy(0,0,35,0)}},
+          3, 3, {Terrain}, 1.0f,
+          "A venomous scorpion adapted to the harsh desert, striking with deadly precision.", {"Poison"} },
+
+        { "Cave Bat Swarm",
+          {{50, 50, 0.01f, 0.01f, 6, 0, 0, 0, 0.2f, 1.8f, 0.2f, 1.0f, 2, 40, Economy(0,0,25,0)}},
+          2, 2, {Dungeon}, 1.0f,
+          "A swarm of bats from deep caves, overwhelming foes with numbers.", {} },
+
+        { "Ruins Guardian",
+          {{120, 120, 0.1f, 0.12f, 12, 8, 0, 0, 0.04f, 1.4f, 0.03f, 1.1f, 5, 85, Economy(0,0,60,0)}},
+          5, 5, {Dungeon}, 1.0f,
+          "An ancient guardian of forgotten ruins, infused with arcane energy.", {"Magic Dampening"} },
+
+        { "Plains Wolf Pack",
+          {{90, 90, 0.06f, 0.03f, 12, 0, 0, 0, 0.03f, 1.4f, 0.02f, 1.0f, 4, 65, Economy(0,0,45,0)}},
+          4, 4, {Terrain}, 1.0f,
+          "A pack of wolves roaming the plains, hunting in coordinated attacks.", {} },
+
+        { "Volcano Imp",
+          {{65, 65, 0.03f, 0.06f, 5, 8, 0, 0, 0.08f, 1.6f, 0.1f, 1.2f, 3, 55, Economy(0,0,40,0)}},
+          3, 3, {Terrain}, 1.0f,
+          "A mischievous imp from volcanic regions, hurling fireballs.", {"Burning"} },
+
+        { "Frozen Yeti",
+          {{130, 130, 0.1f, 0.08f, 15, 5, 0, 0, 0.03f, 1.3f, 0.02f, 1.0f, 6, 100, Economy(0,0,75,0)}},
+          6, 6, {Terrain}, 1.0f,
+          "A massive yeti from frozen tundras, wielding icy winds.", {"Freeze"} },
+
+        { "Giant Spider",
+          {{110, 110, 0.03f, 0.03f, 9, 0, 0, 0, 0.0f, 1.5f, 0.1f, 1.0f, 3, 55, Economy(0,0,40,0)}},
+          3, 3, {Dungeon, Terrain}, 1.0f,
+          "A massive spider with venomous fangs, lurking in dark corners.", {"Poison"} },
+
+        { "Bandit Leader",
+          {{85, 85, 0.06f, 0.04f, 12, 0, 0, 0, 0.05f, 1.6f, 0.05f, 1.0f, 4, 75, Economy(0,1,0,0)}},
+          4, 4, {PeacefulTown, Terrain}, 1.0f,
+          "A cunning bandit leader, skilled in combat and tactics.", {} },
+
+        { "Dark Knight",
+          {{120, 120, 0.1f, 0.08f, 15, 5, 0, 0, 0.03f, 1.4f, 0.02f, 1.0f, 5, 90, Economy(0,1,50,0)}},
+          5, 5, {Dungeon}, 1.0f,
+          "A knight corrupted by dark magic, wielding a cursed blade.", {"Bleeding"} },
+
+        { "Stone Golem",
+          {{180, 180, 0.15f, 0.1f, 18, 0, 0, 0, 0.0f, 1.2f, 0.0f, 1.0f, 8, 130, Economy(0,2,0,0)}},
+          8, 8, {Dungeon}, 1.0f,
+          "An ancient golem made of stone, impervious to most attacks.", {} },
+
+        { "Fire Imp",
+          {{70, 70, 0.02f, 0.04f, 6, 8, 0, 0, 0.08f, 1.7f, 0.15f, 1.2f, 4, 65, Economy(0,0,50,0)}},
+          4, 4, {Terrain}, 1.0f,
+          "A small fiery demon, hurling balls of flame.", {"Burning"} },
+
+        { "Necromancer",
+          {{80, 80, 0.04f, 0.12f, 4, 18, 0, 0, 0.05f, 1.5f, 0.05f, 1.4f, 7, 110, Economy(0,1,50,0)}},
+          7, 7, {Dungeon}, 1.0f,
+          "A master of death magic, raising undead minions.", {"Mana Weakness"} },
+
+        { "Griffin",
+          {{140, 140, 0.08f, 0.06f, 16, 0, 0, 0, 0.04f, 1.5f, 0.05f, 1.0f, 6, 105, Economy(0,1,25,0)}},
+          6, 6, {Terrain}, 1.0f,
+          "A majestic beast with eagle wings and lion body, fiercely territorial.", {} },
+
+        { "Mermaid",
+          {{90, 90, 0.05f, 0.08f, 8, 10, 0, 0, 0.06f, 1.6f, 0.1f, 1.1f, 5, 85, Economy(0,0,75,0)}},
+          5, 5, {Terrain}, 1.0f,
+          "A seductive sea creature, luring sailors to their doom.", {"Freeze"} },
+
+        { "Troll Shaman",
+          {{160, 160, 0.12f, 0.08f, 14, 12, 0, 0, 0.02f, 1.3f, 0.01f, 1.0f, 7, 125, Economy(0,1,0,0)}},
+          7, 7, {Terrain, Dungeon}, 1.0f,
+          "A shaman troll wielding primal magic and brute strength.", {"Poison"} }
+    });
+    static constexpr auto builtinTemplates = columnOf(builtinRows, &Row::hot);
+    static constexpr auto builtinText = columnOf(builtinRows, &Row::cold);
+    static constexpr auto builtinIndex = indexByName(builtinTemplates, &EnemyTemplate::name);
+    static constexpr size_t locationTypeCount = SpellStore + 1;
+
+    TableView<EnemyTemplate> templates = builtinTemplates;
+    TableView<EnemyText> text = builtinText; // row for row with templates
+    NameLookup byName = builtinIndex.lookup();
+
+    EnemyDatabase() { buildSpawnTables(); }
+
+    // Points the table at rows loaded from a content blob.
+    void load(TableView<EnemyTemplate> rows, TableView<EnemyText> texts, NameLookup index) {
+        templates = rows;
+        text = texts;
+        byName = index;
+        buildSpawnTables();
+    }
+
+    bool canSpawn(int difficultyLevel, LocationType locationType) const {
+        return !spawnTable(locationType, difficultyLevel).enemies.empty();
+    }
+
+    Enemy getRandomEnemy(int difficultyLevel, LocationType locationType) const {
+        return rollSpawn(spawnTable(locationType, difficultyLevel), "No valid enemies for this difficulty level and location type!");
+    }
+    Enemy getRandomEnemy(int difficultyLevel) const {
+        return rollSpawn(spawnTable(locationTypeCount, difficultyLevel), "No valid enemies for this difficulty level!");
+    }
+
+private:
+    struct SpawnTable {
+        std::vector<EnemyId> enemies;
+        AliasTable sampler; // over enemies
+    };
+
+    const SpawnTable& spawnTable(size_t row, int difficultyLevel) const {
+        static const SpawnTable none;
+        if (difficultyLevel < 0 || row > locationTypeCount) return none;
+        return spawnTables[row * (maxDifficulty + 1) + static_cast<size_t>(std::min(difficultyLevel, maxDifficulty))];
+    }
+
+    Enemy rollSpawn(const SpawnTable& table, const char* emptyMessage) const {
+        if (table.enemies.empty()) throw std::runtime_error(emptyMessage);
+        EnemyId id = table.enemies[table.sampler.sample(randomStream())];
+        return Enemy{ id, templates[id.index()].stats, {} };
+    }
+
+    // One spawn table per (location type, difficulty); the extra last row ignores location.
+    // Difficulties above the hardest template share its table.
+    void buildSpawnTables() {
+        maxDifficulty = 0;
+        for (const auto& tmpl : templates) maxDifficulty = std::max(maxDifficulty, tmpl.difficultyLevel);
+        spawnTables.assign((locationTypeCount + 1) * (static_cast<size_t>(maxDifficulty) + 1), SpawnTable());
+        for (size_t row = 0; row <= locationTypeCount; ++row) {
+            for (int difficulty = 0; difficulty <= maxDifficulty; ++difficulty) {
+                SpawnTable& table = spawnTables[row * (maxDifficulty + 1) + static_cast<size_t>(difficulty)];
+                std::vector<float> weights;
+                for (size_t i = 0; i < templates.size(); ++i) {
+                    const EnemyTemplate& tmpl = templates[i];
+                    if (tmpl.difficultyLevel > difficulty || !(tmpl.spawnWeight > 0.0f)) continue;
+                    if (row < locationTypeCount &&
+                        std::find(tmpl.allowedLocations.begin(), tmpl.allowedLocations.end(), static_cast<LocationType>(row)) == tmpl.allowedLocations.end()) {
+                        continue;
+                    }
+                    table.enemies.push_back(EnemyId(i));
+                    weights.push_back(tmpl.spawnWeight);
+                }
+                if (!weights.empty()) table.sampler = AliasTable(weights);
+            }
+        }
+    }
+
+    std::vector<SpawnTable> spawnTables;
+    int maxDifficulty = 0;
+};
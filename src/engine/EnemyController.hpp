@@ -0,0 +1,96 @@
+#pragma once
+
+#include "GameData.hpp"
+
+class EnemyController {
+public:
+   
+    Enemy encounterEnemy(int difficultyLevel, LocationType locationType = Terrain) {
+        Enemy enemy = enemyDB.getRandomEnemy(difficultyLevel, locationType);
+        enemyScaleLevel(enemy, difficultyLevel, locationType);
+
+        gameOut() << "A wild " << nameOf(enemy) << " has appeared!" << endl;
+        return enemy;
+    }
+
+    // False where nothing lives, e.g. a spell store, so the caller can skip the encounter.
+    bool canEncounter(int difficultyLevel, LocationType locationType = Terrain) const {
+        return enemyDB.canSpawn(difficultyLevel, locationType);
+    }
+
+    Enemy getEnemy(EnemyId id, int playerLevel, LocationType locationType = Terrain) {
+        Enemy enemy{ id, enemyDB.templates[id.index()].stats, {} };
+        enemyScaleLevel(enemy, playerLevel, locationType);
+        return enemy;
+    }
+
+    Enemy getEnemyByName(const string& name, int playerLevel, LocationType locationType = Terrain) {
+        size_t index = enemyDB.byName.find(name);
+        if (index != NameLookup::none) return getEnemy(EnemyId(index), playerLevel, locationType);
+        throw std::runtime_error("Enemy not found: " + name);
+    }
+
+    void enemyGoldExpDrop(Player& player, const Enemy& enemy) {
+        player.economy.addCurrency(enemy.stats.data.economy.copper);
+        player.stats.expe += enemy.stats.data.expe;
+
+        gameOut() << "You have defeated " << nameOf(enemy)
+             << ", you gained " << enemy.stats.data.economy.toString()
+             << " and " << enemy.stats.data.expe
+             << " experience!" << endl;
+
+        if (player.defeatedEnemies.insert(enemy.id).second) {
+            player.hasNewDictionaryEntry = true;
+        }
+    }
+
+    void enemyScaleLevel(Enemy& enemy, int difficultyLevel, LocationType locationType = Terrain) {
+        if (enemy.stats.scaled || enemy.stats.data.level >= difficultyLevel)
+            return;
+
+        float scale = 1.0f + static_cast<float>(difficultyLevel - enemy.stats.data.level) * 0.1f;
+        if (scale < 0.5f) scale = 0.5f;
+
+        enemy.stats.scale(scale);
+
+        float locationMultiplier = 1.0f;
+        switch (locationType) {
+            case PeacefulVillage: locationMultiplier = 0.8f; break;
+            case PeacefulTown: locationMultiplier = 0.9f; break;
+            case Terrain: locationMultiplier = 1.0f; break;
+            case Dungeon: locationMultiplier = 1.2f; break;
+            case SpellStore: locationMultiplier = 0.9f; break;
+        }
+        enemy.stats.scale(locationMultiplier);
+
+        switch (locationType) {
+            case PeacefulVillage:
+                enemy.stats.data.dodgeRate += 0.05f;
+                enemy.stats.data.attack = std::max(0, enemy.stats.data.attack - 2);
+                enemy.stats.data.magicAttack = std::max(0, enemy.stats.data.magicAttack - 2);
+                break;
+            case PeacefulTown:
+                enemy.stats.data.dodgeRate += 0.03f;
+                enemy.stats.data.attack = std::max(0, enemy.stats.data.attack - 1);
+                enemy.stats.data.magicAttack = std::max(0, enemy.stats.data.magicAttack - 1);
+                break;
+            case Terrain:
+                break;
+            case Dungeon:
+                enemy.stats.data.magicArmor += 0.1f;
+                enemy.stats.data.magicAttack += 5;
+                enemy.stats.data.dodgeRate = std::max(0.0f, enemy.stats.data.dodgeRate - 0.05f);
+                break;
+            case SpellStore:
+                break;
+        }
+
+        enemy.stats.data.level = difficultyLevel;
+        enemy.stats.scaled = true;
+    }
+
+private:
+    std::string_view nameOf(const Enemy& enemy) const { return enemyDB.templates[enemy.id.index()].name; }
+
+    const EnemyDatabase& enemyDB = gameData().enemies;
+};
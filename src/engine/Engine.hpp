@@ -0,0 +1,4 @@
+#pragma once
+
+// Headless game engine: all game systems, with input and output routed through GameIO.
+#include "Game.hpp"
@@ -0,0 +1,510 @@
+#pragma once
+
+#include "Inventory.hpp"
+#include "NPC.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// Unnamed hiring candidates for the tavern, built ahead on a worker thread while the player is
+// elsewhere. Candidate n for a player level always comes from its own stream, split off the
+// session stream, and candidates are handed out in order of n; so a seed sees the same candidates
+// whether the worker built them or take() had to build one itself. Player levels only go up, so
+// the stock for a lower level is dropped once a higher one is asked for.
+class TavernCandidates {
+public:
+    static constexpr uint64_t readyPerLevel = 3;
+
+    TavernCandidates() : streams(randomStream().split(0x7461'7665'726eULL)) {}
+
+    ~TavernCandidates() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    TavernCandidates(const TavernCandidates&) = delete;
+    TavernCandidates& operator=(const TavernCandidates&) = delete;
+
+    // Keeps readyPerLevel candidates of this player level built ahead; returns at once. The
+    // worker starts on first use.
+    void prepare(int playerLevel) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            dropLevelsBelow(playerLevel);
+            levels[playerLevel].wanted = true;
+            if (!worker.joinable()) worker = std::thread([this] { work(); });
+        }
+        wake.notify_one();
+    }
+
+    // The next candidate for this player level, waiting for the worker if it is building that one
+    // and building it here if nobody is, or if the worker failed to. Errors from building here
+    // reach the caller.
+    NPC take(int playerLevel) {
+        std::unique_lock<std::mutex> lock(mutex);
+        dropLevelsBelow(playerLevel);
+        Level& level = levels[playerLevel];
+        const uint64_t index = level.nextTaken++;
+        if (index == level.nextBuilt) {
+            level.nextBuilt++;
+            lock.unlock();
+            wake.notify_one();
+            return build(playerLevel, index);
+        }
+        built.wait(lock, [&] { return level.ready.count(index) != 0; });
+        std::optional<NPC> npc = std::move(level.ready[index]);
+        level.ready.erase(index);
+        lock.unlock();
+        wake.notify_one();
+        return npc ? std::move(*npc) : build(playerLevel, index);
+    }
+
+private:
+    struct Level {
+        std::map<uint64_t, std::optional<NPC>> ready; // finished candidates by index; empty if the worker failed
+        uint64_t nextBuilt = 0;        // first index nobody has started on
+        uint64_t nextTaken = 0;        // first index not handed out
+        bool wanted = false;
+    };
+
+    NPC build(int playerLevel, uint64_t index) const {
+        CounterRng gen = streams.split(static_cast<uint64_t>(playerLevel)).split(index);
+        return NPCGenerator::generateCandidate(playerLevel, gen);
+    }
+
+    void dropLevelsBelow(int playerLevel) {
+        levels.erase(levels.begin(), levels.lower_bound(playerLevel));
+    }
+
+    // A wanted level with fewer than readyPerLevel candidates started ahead of the player.
+    Level* levelToFill(int& playerLevel) {
+        for (auto& entry : levels) {
+            Level& level = entry.second;
+            if (level.wanted && level.nextBuilt - level.nextTaken < readyPerLevel) {
+                playerLevel = entry.first;
+                return &level;
+            }
+        }
+        return nullptr;
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            int playerLevel = 0;
+            Level* level = nullptr;
+            wake.wait(lock, [&] { return stopping || (level = levelToFill(playerLevel)) != nullptr; });
+            if (stopping) return;
+            const uint64_t index = level->nextBuilt++;
+            lock.unlock();
+            std::optional<NPC> npc;
+            try {
+                npc = build(playerLevel, index);
+            } catch (...) {
+                // Left for take() to build on the calling thread, where the error can surface.
+            }
+            lock.lock();
+            auto entry = levels.find(playerLevel); // the level may have been dropped meanwhile
+            if (entry == levels.end()) continue;
+            if (!npc) entry->second.wanted = false; // don't retry in a loop; prepare() asks again
+            entry->second.ready.emplace(index, std::move(npc));
+            built.notify_all();
+        }
+    }
+
+    const CounterRng streams;
+    std::mutex mutex;
+    std::condition_variable wake;  // the worker: something to build, or stop
+    std::condition_variable built; // take(): a candidate finished
+    std::map<int, Level> levels;   // by player level, from the player's current level up
+    bool stopping = false;
+    std::thread worker;
+};
+
+class Tavern {
+public:
+    // Declined candidates linger for a while and sometimes come up again instead of a new face.
+    static constexpr size_t declinedLimit = 3;
+    static constexpr float declinedReturnChance = 0.25f;
+
+    Tavern(PlayerInventory& inv, std::vector<NPC>& party, NPCGenerator& gen) : inventory(inv), playerParty(party), npcGen(gen) {}
+
+    void openTavern(Player& player, TimeSystem& timeSystem) {
+        candidates.prepare(player.stats.level);
+        bool inTavern = true;
+        while (inTavern) {
+            std::vector<string> lines = {
+                "1. Sleep for 1 Gold (Restore HP & Advance Time)",
+                "2. Buy Food and Drinks",
+                "3. Hire a Party Member (Max 4)",
+                "4. Exit"
+            };
+            
+            gameOut() << "\n--- THE RATTLING FLAGON TAVERN ---" << endl;
+            displayBorderedMenu(lines, "The Tavernkeeper wipes a mug. 'What'll it be?' ");
+            
+            int choice = getNumberInput(1, 4);
+
+            if (choice == 1) {
+                if (player.economy.subtractCurrency(coins(0, 1, 0, 0))) {
+                    player.stats.hitpoints = player.stats.maxHitpoints;
+                    player.sleptToday = true;
+                    timeSystem.advanceTime(player);
+                    gameOut() << "\nYou settle into a hay-stuffed mattress. The world fades to black...\n";
+                    gameOut() << "You wake up feeling refreshed! (HP Restored)\n";
+                } else {
+                    gameOut() << "\n'No coin, no bed,' the Tavernkeeper grunts.\n";
+                }
+            } 
+            else if (choice == 2) { 
+                buyFoodAndDrinks(player);
+            } 
+            else if (choice == 3) {
+                hirePartyMember(player);
+            } 
+            else if (choice == 4) {
+                gameOut() << "You step back out into the cold air.\n";
+                inTavern = false;
+            }
+        }
+    }
+
+private:
+    PlayerInventory& inventory;
+    std::vector<NPC>& playerParty;
+    const FoodandDrinksDatabase& foodDB = gameData().foods;
+    NPCGenerator& npcGen; // the game's, so names free up when party members leave
+    TavernCandidates candidates;
+    std::deque<NPC> declined; // oldest first, all for declinedLevel, names held
+    int declinedLevel = 0;
+
+    void buyFoodAndDrinks(Player& player) {
+        const auto& foods = foodDB.getFoodAndDrink();
+        std::vector<string> foodNames;
+        for (const auto& food : foods) {
+            foodNames.push_back(string(food.name) + " (" + formatCoins(food.price) + ")");
+        }
+
+        gameOut() << "\n--- Available ---" << endl;
+        PagedSelector foodSelector(foodNames);
+        int index = foodSelector.select();
+
+        if (index == -1) return;
+
+        if (player.economy.subtractCurrency(foods[index].price)) {
+            inventory.addItem(PlayerInventory::ItemType::FoodAndDrink, index);
+            gameOut() << "You purchased " << foods[index].name << ". It smells... edible.\n";
+        } else {
+            gameOut() << "You don't have enough coin for that.\n";
+        }
+    }
+
+    // Usually a new face from the prebuilt candidates; now and then the longest-waiting one the
+    // player turned down.
+    NPC nextCandidate(int playerLevel) {
+        if (!declined.empty() && randomStream().chance(declinedReturnChance)) {
+            NPC npc = std::move(declined.front());
+            declined.pop_front();
+            return npc;
+        }
+        NPC npc = candidates.take(playerLevel);
+        npcGen.assignName(npc, randomStream());
+        return npc;
+    }
+
+    // Keeps the candidate's name held while they wait; the oldest one leaves when the queue is full.
+    void decline(NPC npc) {
+        declined.push_back(std::move(npc));
+        if (declined.size() > declinedLimit) {
+            npcGen.releaseName(declined.front());
+            declined.pop_front();
+        }
+    }
+
+    void hirePartyMember(Player& player) {
+        if (playerParty.size() >= 4) {
+            gameOut() << "\n'Your group is too big already,' the Tavernkeeper remarks. (Max 4 members)\n";
+            return;
+        }
+
+        if (declinedLevel != player.stats.level) {
+            for (const NPC& waiting : declined) npcGen.releaseName(waiting);
+            declined.clear();
+            declinedLevel = player.stats.level;
+        }
+        NPC newNPC = nextCandidate(player.stats.level);
+
+        
+        int baseCost = 10;
+        int levelMultiplier = newNPC.level * 2;
+        int statBonus = (newNPC.stats.attack + newNPC.stats.magicAttack + newNPC.stats.armor + newNPC.stats.magicArmor) / 10;
+        int totalCost = baseCost + levelMultiplier + statBonus;
+
+        gameOut() << "\nIn the corner, you see " << newNPC.name << ", a " << newNPC.race.name << " " << newNPC.playerClass.name << " (Lv " << newNPC.level << ").\n";
+        gameOut() << "Hiring cost: " << totalCost << " Gold.\n";
+        gameOut() << "Gear: " << (newNPC.equippedWeapon.empty() ? "Rags" : newNPC.equippedWeapon) << "\n";
+        
+        gameOut() << "Confirm hire? (y/n): ";
+        char confirm = getCharInput();
+
+        if (confirm != 'y' && confirm != 'Y') {
+            gameOut() << "You decide not to hire them.\n";
+            decline(std::move(newNPC));
+            return;
+        }
+
+        if (!player.economy.subtractCurrency(coins(0, totalCost, 0, 0))) {
+            gameOut() << "You realize you can't afford their services.\n";
+            decline(std::move(newNPC));
+            return;
+        }
+
+        newNPC.wagePerWeek = totalCost / 10;
+        playerParty.push_back(newNPC);
+
+        gameOut() << "\n" << newNPC.name << " stands up and joins your cause!\n";
+
+        if (!newNPC.dialogues.empty()) {
+            gameOut() << newNPC.name << " says: \"" << newNPC.randomDialogue(randomStream()) << "\"\n" << endl;
+        }
+
+        
+        const auto& specialNames = NPCText::specialCharacters;
+        if (std::find(specialNames.begin(), specialNames.end(), newNPC.name) != specialNames.end()) {
+            player.hiredSpecialCharacters.insert(newNPC.name);
+            player.hasNewDictionaryEntry = true;
+        }
+    }
+};
+
+class Store {
+public:
+    Store(PlayerInventory& inv) : inventory(inv) {}
+
+    void openStore(Player& player) {
+        bool shopping = true;
+        while (shopping) {
+            gameOut() << "\n=== STORE ===\n";
+            gameOut() << "Currency: " << player.economy.toString() << endl;
+            gameOut() << "1. Buy Potions\n";
+            gameOut() << "2. Buy Equipment\n";
+            gameOut() << "3. Exit Store\n";
+            gameOut() << "Choose an option: ";
+
+            int choice = getNumberInput(1, 3);
+
+            switch (choice) {
+                case 1:
+                    buyPotions(player);
+                    clearScreen();
+                    break;
+                case 2:
+                    buyEquipment(player);
+                    clearScreen();
+                    break;
+                case 3:
+                    shopping = false;
+                    break;
+            }
+        }
+    }
+
+private:
+    PlayerInventory& inventory;
+    const PotionDatabase& potionDB = gameData().potions;
+    const EquipmentandWeaponDatabase& equipmentDB = gameData().equipment;
+
+    // Potions and equipment cost their full listed price, gold and platinum included.
+    void buyPotions(Player& player) {
+        const auto& potions = potionDB.getPotions();
+        std::vector<string> potionNames;
+        for (const auto& potion : potions) {
+            potionNames.push_back(string(potion.name) + " - " + formatCoins(potion.price));
+        }
+        PagedSelector potionSelector(potionNames);
+        size_t index = potionSelector.select();
+        if (player.economy.subtractCurrency(potions[index].price)) {
+            inventory.addItem(PlayerInventory::ItemType::Potion, index);
+            gameOut() << "Bought " << potions[index].name << "!\n";
+        } else {
+            gameOut() << "Not enough currency!\n";
+        }
+    }
+
+    void buyEquipment(Player& player) {
+        const auto& equipment = equipmentDB.getEquipment();
+        std::vector<string> equipmentNames;
+        for (const auto& eq : equipment) {
+            equipmentNames.push_back(string(eq.name) + " - " + formatCoins(eq.price));
+        }
+        PagedSelector equipmentSelector(equipmentNames);
+        size_t index = equipmentSelector.select();
+        if (player.economy.subtractCurrency(equipment[index].price)) {
+            inventory.addItem(PlayerInventory::ItemType::Equipment, index);
+            gameOut() << "Bought " << equipment[index].name << "!\n";
+            if (equipment[index].type == "Weapon") {
+                player.boughtWeapons.insert(nameRegistry().equipment.canonical(EquipmentId(index)));
+                player.hasNewDictionaryEntry = true;
+            }
+        } else {
+            gameOut() << "Not enough currency!\n";
+        }
+    }
+};
+class magicStore {
+public:
+    magicStore(PlayerInventory& inv) : inventory(inv) {}
+
+    void openStore(Player& player) {
+        bool shopping = true;
+        while (shopping) {
+            gameOut() << "\n=== MAGIC STORE ===\n";
+            gameOut() << "Currency: " << player.economy.toString() << endl;
+            gameOut() << "1. Buy Spells\n";
+            gameOut() << "2. Enchant Item\n";
+            gameOut() << "3. Exit Store\n";
+            gameOut() << "Choose an option: ";
+
+            int choice = getNumberInput(1, 3);
+
+            switch (choice) {
+                case 1:
+                    buySpells(player);
+                    clearScreen();
+                    break;
+                case 2:
+                    enchantItem(player);
+                    clearScreen();
+                    break;
+                case 3:
+                    shopping = false;
+                    break;
+            }
+        }
+    }
+
+private:
+    PlayerInventory& inventory;
+    const SpellDatabase& spellDB = gameData().spells;
+    const DebuffDatabase& debuffDB = gameData().debuffs;
+
+    void buySpells(Player& player) {
+        const auto& spells = spellDB.getSpells();
+        std::vector<size_t> availableSpells;
+        for (size_t i = 0; i < spells.size(); ++i) {
+            if (spells[i].requiredLevel <= player.stats.level) {
+                availableSpells.push_back(i);
+            }
+        }
+
+        if (availableSpells.empty()) {
+            gameOut() << "No spells available for your level.\n";
+            return;
+        }
+
+        std::vector<string> spellNames;
+        for (size_t i : availableSpells) {
+            const auto& spell = spells[i];
+            spellNames.push_back(string(spell.spellName) + " - " + formatCoins(spell.price));
+        }
+        PagedSelector spellSelector(spellNames);
+        size_t selectedIndex = spellSelector.select();
+        size_t index = availableSpells[selectedIndex];
+        const auto& spell = spells[index];
+        if (player.economy.subtractCurrency(spell.price)) {
+            
+            const SpellId spellId(index);
+            if (std::find(player.learnedSpells.begin(), player.learnedSpells.end(), spellId) == player.learnedSpells.end()) {
+                player.learnedSpells.push_back(spellId);
+                gameOut() << "Learned " << spell.spellName << "!\n";
+            } else {
+                gameOut() << "You already know " << spell.spellName << "!\n";
+            }
+        } else {
+            gameOut() << "Not enough currency!\n";
+        }
+    }
+
+    void enchantItem(Player& player) {
+        
+        std::vector<size_t> enchantableIndices;
+        const auto& equipment = inventory.equipmentDB.getEquipment();
+        const auto* weapon = inventory.items.get(inventory.equipped.weapon);
+        const auto* staff = inventory.items.get(inventory.equipped.staff);
+        if (weapon && equipment[weapon->dbIndex].type == "Weapon") enchantableIndices.push_back(weapon->dbIndex);
+        if (staff && equipment[staff->dbIndex].type == "Staff") enchantableIndices.push_back(staff->dbIndex);
+        // Listed in table order, as the shop has always shown them.
+        std::sort(enchantableIndices.begin(), enchantableIndices.end());
+
+        if (enchantableIndices.empty()) {
+            gameOut() << "No equipped enchantable items.\n";
+            return;
+        }
+
+        gameOut() << "\n=== ENCHANTABLE ITEMS ===\n";
+        for (size_t j = 0; j < enchantableIndices.size(); ++j) {
+            size_t i = enchantableIndices[j];
+            gameOut() << j + 1 << ". " << equipment[i].name << " (" << equipment[i].type << ")\n";
+        }
+        gameOut() << "Choose item to enchant (0 to cancel): ";
+        int itemChoice = getNumberInput(0, static_cast<int>(enchantableIndices.size()));
+        if (itemChoice == 0) return;
+
+        size_t itemIndex = enchantableIndices[static_cast<size_t>(itemChoice - 1)];
+        const auto& item = equipment[itemIndex];
+
+    
+        if (!player.economy.subtractCurrency(coins(0, 100, 0, 0))) {
+            gameOut() << "Not enough gold! Enchanting costs 100 gold.\n";
+            return;
+        }
+
+        if (item.type == "Weapon") {
+           
+            const auto& allDebuffs = debuffDB.getDebuffs();
+            std::vector<DebuffId> availableDebuffs;
+            std::vector<string> debuffNames;
+            for (size_t i = 0; i < allDebuffs.size(); ++i) {
+                if (!allDebuffs[i].application.enchantOnWeapon) continue;
+                availableDebuffs.push_back(DebuffId(i));
+                debuffNames.push_back(string(allDebuffs[i].name) + " - " + string(debuffDB.getDebuffText()[i].effectDesc));
+            }
+            PagedSelector debuffSelector(debuffNames);
+            const DebuffId debuffId = availableDebuffs[debuffSelector.select()];
+            const auto& debuff = allDebuffs[debuffId.index()];
+
+           
+            player.equippedWeaponDebuffs.push_back(debuffId);
+            player.equippedWeaponDebuffChance = item.debuffChance; 
+
+  
+            PlayerInventory::ItemHandle stack = inventory.findItem(PlayerInventory::ItemType::Equipment, itemIndex);
+            if (auto* invItem = inventory.items.get(stack)) invItem->enchanted = true;
+
+            gameOut() << "Enchanted " << item.name << " with " << debuff.name << "!\n";
+        } else if (item.type == "Staff") {
+          
+            const auto& spells = spellDB.getSpells();
+            std::vector<string> spellNames;
+            for (size_t i = 0; i < spells.size(); ++i) {
+                spellNames.push_back(string(spells[i].spellName) + " - " + string(spellDB.getSpellText()[i].description));
+            }
+            PagedSelector spellSelector(spellNames);
+            size_t spellIndex = spellSelector.select();
+            const auto& spell = spells[spellIndex];
+
+           
+            player.equippedStaffSpells.push_back(SpellId(spellIndex));
+
+      
+            inventory.refreshGear(player);
+
+            gameOut() << "Enchanted " << item.name << " with " << spell.spellName << "!\n";
+        }
+    }
+};
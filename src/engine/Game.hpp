@@ -0,0 +1,497 @@
+#pragma once
+
+#include "Establishments.hpp"
+#include "Travel.hpp"
+
+struct MenuItem {
+    string name;
+    string description;
+    std::function<void()> action;
+};
+class Menu {
+public:
+    Menu(const std::vector<MenuItem>& menuItems, const std::map<string, std::vector<size_t>>& menuCategories, Player& heroRef)
+        : items(menuItems), categories(menuCategories), hero(heroRef) {}
+
+    void displayAndExecute() {
+        while (true) {
+            display();
+            int choice = getNumberInput(1, static_cast<int>(items.size()));
+            if (choice >= 1 && choice <= static_cast<int>(items.size())) {
+                items[static_cast<size_t>(choice - 1)].action();
+                break;
+            } else {
+                gameOut() << "Invalid choice!" << endl;
+            }
+        }
+    }
+
+private:
+    std::vector<MenuItem> items;
+    std::map<string, std::vector<size_t>> categories;
+    Player& hero;
+
+    void display() {
+  
+        size_t maxWidth = 0; 
+
+        string timeLine = "Current Time: " + hero.timeSystem.getPeriodString();
+        string passedLine = "Time Passed: " + hero.timeSystem.getFormattedTimePassed();
+        string locationLine = "Current Location: " + hero.currentLocation;
+        string currencyLine = "Currency: " + hero.economy.toString();
+
+        maxWidth = std::max(maxWidth, timeLine.length());
+        maxWidth = std::max(maxWidth, passedLine.length());
+        maxWidth = std::max(maxWidth, locationLine.length());
+        maxWidth = std::max(maxWidth, currencyLine.length());
+
+       
+        for (const auto& cat : categories) {
+            if (!cat.second.empty()) {
+                string catLine = "[" + cat.first + "]";
+                maxWidth = std::max(maxWidth, catLine.length());
+            }
+        }
+
+        
+        for (const auto& item : items) {
+            string optionLine = std::to_string(&item - &items[0] + 1) + ". " + item.name + " - " + item.description;
+            maxWidth = std::max(maxWidth, optionLine.length());
+        }
+
+        string border = string(maxWidth, '=');
+        string emptyLine = string(maxWidth, ' ');
+
+        gameOut() << border << endl;
+        gameOut() << timeLine << string(maxWidth - timeLine.length(), ' ') << endl;
+        gameOut() << passedLine << string(maxWidth - passedLine.length(), ' ') << endl;
+        gameOut() << locationLine << string(maxWidth - locationLine.length(), ' ') << endl;
+        gameOut() << currencyLine << string(maxWidth - currencyLine.length(), ' ') << endl;
+        gameOut() << emptyLine << endl;
+
+       
+        std::vector<string> categoryOrder = {"Character", "Local Establishments", "Actions", "System"};
+
+        for (const string& catName : categoryOrder) {
+            auto it = categories.find(catName);
+            if (it != categories.end() && !it->second.empty()) {
+                string catLine = "[" + catName + "]";
+                gameOut() << catLine << string(maxWidth - catLine.length(), ' ') << endl;
+                for (size_t idx : it->second) {
+                    string optionLine = std::to_string(idx + 1) + ". " + items[idx].name + " - " + items[idx].description;
+                    gameOut() << optionLine << string(maxWidth - optionLine.length(), ' ') << endl;
+                }
+                gameOut() << emptyLine << endl;
+            }
+        }
+
+        gameOut() << border << endl;
+        gameOut() << "Choose an option: ";
+    }
+};
+
+inline void deductWeeklyWages(Player& player, std::vector<NPC>& playerParty) {
+    int totalWages = 0;
+    for (const auto& npc : playerParty) {
+        totalWages += npc.wagePerWeek;
+    }
+    if (player.economy.subtractCurrency(coins(0, totalWages, 0, 0))) {
+        gameOut() << "Paid " << totalWages << " gold in wages to party members.\n";
+    } else {
+        gameOut() << "Not enough gold to pay wages! Party members may become unhappy.\n";
+    }
+}
+
+inline void manageParty(std::vector<NPC>& playerParty, NPCGenerator& npcGen, Player& player) {
+    if (playerParty.empty()) {
+        gameOut() << "Your party is empty.\n";
+        gameOut() << "Press Enter to continue...";
+        waitForEnter();
+        return;
+    }
+
+    
+    int totalWages = 0;
+    for (const auto& npc : playerParty) {
+        totalWages += npc.wagePerWeek;
+    }
+    if (!player.economy.subtractCurrency(coins(0, totalWages, 0, 0))) {
+       
+        size_t index = randomStream().below(playerParty.size());
+        string name = playerParty[index].name;
+        npcGen.releaseName(playerParty[index]);
+        playerParty.erase(playerParty.begin() + static_cast<int>(index));
+        gameOut() << "Due to insufficient gold, " << name << " has left the party.\n";
+        gameOut() << "Press Enter to continue...";
+        waitForEnter();
+        return;
+    } else {
+        
+        player.economy.addCurrency(coins(0, totalWages, 0, 0));
+    }
+
+    std::vector<string> lines;
+    lines.push_back("Current Party Members:");
+    for (size_t i = 0; i < playerParty.size(); ++i) {
+        const auto& npc = playerParty[i];
+        string line = std::to_string(i + 1) + ". " + npc.name + " (" + string(npc.race.name) + " " + string(npc.playerClass.name) + ", Level " + std::to_string(npc.level) + ") - Weekly Wage: " + std::to_string(npc.wagePerWeek) + " gold";
+        lines.push_back(line);
+    }
+    lines.push_back("Select a member (0 to cancel):");
+    displayBorderedMenu(lines, "");
+
+    int choice = getNumberInput(0, static_cast<int>(playerParty.size()));
+    if (choice == 0) return;
+
+    size_t index = static_cast<size_t>(choice - 1);
+
+    gameOut() << "What do you want to do with " << playerParty[index].name << "?" << endl;
+    gameOut() << "1. Talk to member" << endl;
+    gameOut() << "2. What is your story?" << endl;
+    gameOut() << "3. Kick member" << endl;
+    gameOut() << "4. Cancel" << endl;
+    int action = getNumberInput(1, 4);
+
+    if (action == 1) {
+
+        if (!playerParty[index].dialogues.empty()) {
+            gameOut() << playerParty[index].name << " says: \"" << playerParty[index].randomDialogue(randomStream()) << "\"" << endl;
+        } else {
+            gameOut() << playerParty[index].name << " has nothing to say." << endl;
+        }
+        gameOut() << "Press Enter to continue...";
+        waitForEnter();
+    } else if (action == 2) {
+        gameOut() << playerParty[index].name << "'s story: " << playerParty[index].storyText() << endl;
+        gameOut() << "Press Enter to continue...";
+        waitForEnter();
+    } else if (action == 3) {
+
+        string name = playerParty[index].name;
+        npcGen.releaseName(playerParty[index]);
+        playerParty.erase(playerParty.begin() + static_cast<int>(index));
+        gameOut() << name << " has been kicked from the party.\n";
+        gameOut() << "Press Enter to continue...";
+        waitForEnter();
+    } else {
+        // Cancel
+    }
+}
+
+inline void showDictionary(Player& hero) {
+    const NameRegistry& names = nameRegistry();
+    hero.hasNewDictionaryEntry = false;
+    bool inDictionary = true;
+    while (inDictionary) {
+        clearScreen();
+        std::vector<string> sections = {"1. Enemies", "2. Weapons", "3. Locations", "4. Events", "5. Special Characters", "6. Exit"};
+        displayBorderedMenu(sections, "Choose a section: ");
+        int choice = getNumberInput(1, 6);
+        if (choice == 6) {
+            inDictionary = false;
+            continue;
+        }
+        if (choice == 1) { 
+            if (hero.defeatedEnemies.empty()) {
+                gameOut() << "No defeated enemies yet.\n";
+                waitForEnter();
+                continue;
+            }
+            std::vector<EnemyId> enemyIds = sortedByName(hero.defeatedEnemies, names.enemies);
+            std::vector<string> enemyNames;
+            for (EnemyId id : enemyIds) enemyNames.emplace_back(names.enemies.name(id));
+            PagedSelector enemySelector(enemyNames);
+            size_t idx = enemySelector.select();
+            const string& enemyName = enemyNames[idx];
+            const auto& tmpl = gameData().enemies.templates[enemyIds[idx].index()];
+            bool inEnemy = true;
+            while (inEnemy) {
+                clearScreen();
+                gameOut() << "=== " << enemyName << " ===\n";
+                gameOut() << "1. Stats\n";
+                gameOut() << "2. Description\n";
+                gameOut() << "3. Exit\n";
+                gameOut() << "Choose: ";
+                int subChoice = getNumberInput(1, 3);
+                if (subChoice == 1) {
+                    gameOut() << "HP: " << tmpl.stats.data.hitpoints << "/" << tmpl.stats.data.maxHitpoints << "\n";
+                    gameOut() << "Attack: " << tmpl.stats.data.attack << "\n";
+                    gameOut() << "Magic Attack: " << tmpl.stats.data.magicAttack << "\n";
+                    gameOut() << "Armor: " << tmpl.stats.data.armor << "\n";
+                    gameOut() << "Magic Armor: " << tmpl.stats.data.magicArmor << "\n";
+                    gameOut() << "Level: " << tmpl.stats.data.level << "\n";
+                    gameOut() << "Experience: " << tmpl.stats.data.expe << "\n";
+                    waitForEnter();
+                } else if (subChoice == 2) {
+                    gameOut() << gameData().enemies.text[enemyIds[idx].index()].lore << "\n";
+                    waitForEnter();
+                } else {
+                    inEnemy = false;
+                }
+            }
+        } else if (choice == 2) { 
+            if (hero.boughtWeapons.empty()) {
+                gameOut() << "No bought weapons yet.\n";
+                waitForEnter();
+                continue;
+            }
+            std::vector<EquipmentId> weaponIds = sortedByName(hero.boughtWeapons, names.equipment);
+            std::vector<string> weaponNames;
+            for (EquipmentId id : weaponIds) weaponNames.emplace_back(names.equipment.name(id));
+            PagedSelector weaponSelector(weaponNames);
+            size_t idx = weaponSelector.select();
+            const string& weaponName = weaponNames[idx];
+            const auto& eq = gameData().equipment.getEquipment()[weaponIds[idx].index()];
+            bool inWeapon = true;
+            while (inWeapon) {
+                clearScreen();
+                gameOut() << "=== " << weaponName << " ===\n";
+                gameOut() << "1. Stats\n";
+                gameOut() << "2. Description\n";
+                gameOut() << "3. Exit\n";
+                gameOut() << "Choose: ";
+                int subChoice = getNumberInput(1, 3);
+                if (subChoice == 1) {
+                    gameOut() << "Type: " << eq.type << "\n";
+                    gameOut() << "Attack Increase: " << eq.attackIncrease << "\n";
+                    gameOut() << "Magic Attack Increase: " << eq.magicAttackIncrease << "\n";
+                    gameOut() << "Crit Rate Increase: " << eq.critRateIncrease << "\n";
+                    gameOut() << "Crit Damage Increase: " << eq.critDamageIncrease << "\n";
+                    gameOut() << "Price: " << formatCoins(eq.price) << "\n";
+                    waitForEnter();
+                } else if (subChoice == 2) {
+                    gameOut() << gameData().equipment.getEquipmentText()[weaponIds[idx].index()].effectDesc << "\n";
+                    waitForEnter();
+                } else {
+                    inWeapon = false;
+                }
+            }
+        } else if (choice == 3) { 
+            if (hero.discoveredLocations.empty()) {
+                gameOut() << "No discovered locations yet.\n";
+                waitForEnter();
+                continue;
+            }
+            std::vector<LocationId> locationIds = sortedByName(hero.discoveredLocations, names.locations);
+            std::vector<string> locationNames;
+            for (LocationId id : locationIds) locationNames.emplace_back(names.locations.name(id));
+            PagedSelector locationSelector(locationNames);
+            size_t idx = locationSelector.select();
+            const string& locationName = locationNames[idx];
+            const auto& loc = gameData().locations.getLocations()[locationIds[idx].index()];
+            bool inLocation = true;
+            while (inLocation) {
+                clearScreen();
+                gameOut() << "=== " << locationName << " ===\n";
+                gameOut() << "1. Stats\n";
+                gameOut() << "2. Description\n";
+                gameOut() << "3. Exit\n";
+                gameOut() << "Choose: ";
+                int subChoice = getNumberInput(1, 3);
+                if (subChoice == 1) {
+                    gameOut() << "Difficulty Level: " << loc.difficultyLevel << "\n";
+                    string typeStr;
+                    switch (loc.type) {
+                        case PeacefulVillage: typeStr = "Peaceful Village"; break;
+                        case PeacefulTown: typeStr = "Peaceful Town"; break;
+                        case Dungeon: typeStr = "Dungeon"; break;
+                        case Terrain: typeStr = "Terrain"; break;
+                        case SpellStore: typeStr = "Spell Store"; break;
+                    }
+                    gameOut() << "Type: " << typeStr << "\n";
+                    waitForEnter();
+                } else if (subChoice == 2) {
+                    gameOut() << gameData().locations.getLocationText()[locationIds[idx].index()].description << "\n";
+                    waitForEnter();
+                } else {
+                    inLocation = false;
+                }
+            }
+        } else if (choice == 4) { 
+            if (hero.encounteredEvents.empty()) {
+                gameOut() << "No encountered events yet.\n";
+                waitForEnter();
+                continue;
+            }
+            std::vector<EventId> eventIds = sortedByName(hero.encounteredEvents, names.events);
+            std::vector<string> eventNames;
+            for (EventId id : eventIds) eventNames.emplace_back(names.events.name(id));
+            PagedSelector eventSelector(eventNames);
+            size_t idx = eventSelector.select();
+            const string& eventName = eventNames[idx];
+            const auto& ev = gameData().events.getEvents()[eventIds[idx].index()];
+            bool inEvent = true;
+            while (inEvent) {
+                clearScreen();
+                gameOut() << "=== " << eventName << " ===\n";
+                gameOut() << "1. Stats\n";
+                gameOut() << "2. Description\n";
+                gameOut() << "3. Exit\n";
+                gameOut() << "Choose: ";
+                int subChoice = getNumberInput(1, 3);
+                if (subChoice == 1) {
+                    gameOut() << "Gold Reward: " << ev.goldReward << "\n";
+                    gameOut() << "Exp Reward: " << ev.expReward << "\n";
+                    gameOut() << "Health Effect: " << ev.healthEffect << "\n";
+                    gameOut() << "Mana Effect: " << ev.manaEffect << "\n";
+                    gameOut() << "Enemy Encounter: " << (ev.enemyEncounter ? "Yes" : "No") << "\n";
+                    if (ev.enemyEncounter) {
+                        gameOut() << "Enemy: " << ev.enemyName << "\n";
+                        gameOut() << "Count: " << ev.enemyCount << "\n";
+                    }
+                    waitForEnter();
+                } else if (subChoice == 2) {
+                    gameOut() << gameData().events.getEventText()[eventIds[idx].index()].description << "\n";
+                    waitForEnter();
+                } else {
+                    inEvent = false;
+                }
+            }
+        } else if (choice == 5) {
+            if (hero.hiredSpecialCharacters.empty()) {
+                gameOut() << "No hired special characters yet.\n";
+                waitForEnter();
+                continue;
+            }
+            clearScreen();
+            gameOut() << "=== Special Characters ===\n";
+            for (const auto& name : hero.hiredSpecialCharacters) {
+                gameOut() << "- " << name << "\n";
+            }
+            gameOut() << "\nPress Enter to continue...";
+            waitForEnter();
+        }
+    }
+}
+
+inline void mainMenu(Player& hero, bool debugMode = false) {
+    EnemyController enemyCtrl;
+    CombatSystem combat;
+    PlayerInventory playerInventory;
+    PlayerController heroStats(hero, playerInventory);
+    Store store(playerInventory);
+    std::vector<NPC> playerParty;
+    NPCGenerator npcGen;
+    Tavern tavern(playerInventory, playerParty, npcGen);
+    magicStore magicStore(playerInventory);
+    PopulationConfig populationConfig;
+    populationConfig.seed = randomStream().split(0x7265'7369'6465'6e74ULL).streamKey();
+    const WorldPopulation world = PopulationGenerator().populate(populationConfig, npcGen);
+    TravelSystem travelSystem(npcGen, world, debugMode);
+
+    int actionCounter = 0;
+    int lastWeekPaid = 0;
+    bool running = true;
+
+    while (running) {
+        clearScreen();
+
+        if (hero.timeSystem.getTotalWeeks() > lastWeekPaid && !playerParty.empty()) {
+            deductWeeklyWages(hero, playerParty);
+            lastWeekPaid = hero.timeSystem.getTotalWeeks();
+        }
+        std::vector<MenuItem> items;
+        std::map<string, std::vector<size_t>> categories;
+
+        
+        categories["Character"] = {};
+        items.push_back({"Show Player Stats", "View your character's current stats.", [&]() { heroStats.showStats(); }});
+        categories["Character"].push_back(items.size() - 1);
+        items.push_back({"Inventory", "Manage your items and equipment.", [&]() { playerInventory.showInventory(hero); }});
+        categories["Character"].push_back(items.size() - 1);
+        items.push_back({"Party Management", "View and manage your party members.", [&]() { manageParty(playerParty, npcGen, hero); }});
+        categories["Character"].push_back(items.size() - 1);
+        string dictionaryName = hero.hasNewDictionaryEntry ? "Dictionary [!]" : "Dictionary";
+        items.push_back({dictionaryName, "Review discovered enemies, locations, weapons, events, and special characters.", [&]() { showDictionary(hero); }});
+        categories["Character"].push_back(items.size() - 1);
+
+        bool hasStore = hero.currentLocationType == PeacefulVillage || hero.currentLocationType == PeacefulTown;
+        bool hasTavern = hero.currentLocationType == PeacefulTown;
+        bool hasMagicStore = hero.currentLocationType == SpellStore;
+
+        if (hasStore || hasTavern || hasMagicStore) {
+            categories["Local Establishments"] = {};
+            if (hasStore) {
+                items.push_back({"Store", "Buy potions and equipment.", [&]() { store.openStore(hero); }});
+                categories["Local Establishments"].push_back(items.size() - 1);
+            }
+            if (hasTavern) {
+                items.push_back({"Tavern", "Rest, buy food, hire party members.", [&]() { tavern.openTavern(hero, hero.timeSystem); }});
+                categories["Local Establishments"].push_back(items.size() - 1);
+            }
+            if (hasMagicStore) {
+                items.push_back({"Magic Store", "Buy spells.", [&]() { magicStore.openStore(hero); }});
+                categories["Local Establishments"].push_back(items.size() - 1);
+            }
+        }
+
+        categories["Actions"] = {};
+        items.push_back({"Explore", "Venture out and face challenges.", [&]() {
+            if (randomStream().chance(0.8f)) {
+                CombatArena arena;
+                arena.addEnemy(enemyCtrl.encounterEnemy(1, Terrain));
+                CombatScreen combatScreen(hero, playerParty, arena, hero.timeSystem, npcGen);
+                combatScreen.startCombat(combat, playerInventory);
+
+                if (hero.stats.hitpoints > 0) {
+                    awardDefeatedEnemies(hero, arena, enemyCtrl);
+                    heroStats.levelUpChecker();
+                }
+            } else {
+                handleEvent(hero, enemyCtrl, combat, playerInventory, heroStats, npcGen);
+            }
+
+            actionCounter++;
+            if (actionCounter % 4 == 0) {
+                hero.timeSystem.advanceTime(hero);
+            }
+        }});
+        categories["Actions"].push_back(items.size() - 1);
+
+        items.push_back({"Travel", "Move to different locations.", [&]() {
+            travelSystem.travel(hero, enemyCtrl, combat, playerInventory, heroStats, hero.timeSystem);
+        }});
+        categories["Actions"].push_back(items.size() - 1);
+
+        items.push_back({"Pass Time", "Advance time without action.", [&]() {
+            actionCounter++;
+            if (actionCounter % 4 == 0) {
+                hero.timeSystem.advanceTime(hero);
+                gameOut() << "Time has passed.\n";
+                clearScreen();
+            }
+        }});
+        categories["Actions"].push_back(items.size() - 1);
+
+    
+        categories["System"] = {};
+        items.push_back({"Basics", "Explain the game mechanics.", [&]() {
+            clearScreen();
+            gameOut() << "\n=== GAME BASICS ===\n";
+            gameOut() << "Time System:\n";
+            gameOut() << "- 4 turns advance the state of the day (Morning -> Afternoon -> Evening -> Night).\n";
+            gameOut() << "- After Night, a new day begins, and weeks accumulate.\n\n";
+            gameOut() << "Currency System:\n";
+            gameOut() << "- 100 Copper = 1 Silver\n";
+            gameOut() << "- 100 Silver = 1 Gold\n";
+            gameOut() << "- 100 Gold = 1 Platinum\n\n";
+            gameOut() << "Sleep Mechanic:\n";
+            gameOut() << "- If not slept, reduce health by ~5% at the start of each new day.\n";
+            gameOut() << "- Sleep at the Tavern to restore HP and avoid the penalty.\n\n";
+            gameOut() << "Other Mechanics:\n";
+            gameOut() << "- Explore to fight enemies or encounter events.\n";
+            gameOut() << "- Travel to discover new locations.\n";
+            gameOut() << "- Manage your party, inventory, and stats.\n";
+            gameOut() << "- Visit stores, taverns, and magic shops in towns.\n\n";
+            gameOut() << "Press Enter to continue...";
+            waitForEnter();
+        }});
+        categories["System"].push_back(items.size() - 1);
+        items.push_back({"Exit", "Quit the game.", [&]() { running = false; }});
+        categories["System"].push_back(items.size() - 1);
+
+        Menu menu(items, categories, hero);
+        menu.displayAndExecute();
+        clearScreen();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ContentBlob.hpp"
+
+// Every static content table, shared read-only by all screens, controllers and threads. By default
+// the rows are the constexpr arrays compiled into the game; given a content blob, each table points
+// into the mapped blob instead. Objects that used to own a database copy keep a const reference
+// into this.
+struct GameData {
+    ContentBlob blob; // empty when running on the built-in tables
+    PlayerClassCollection classes;
+    PlayerRaceDatabase races;
+    FoodandDrinksDatabase foods;
+    PotionDatabase potions;
+    EquipmentandWeaponDatabase equipment;
+    DebuffDatabase debuffs;
+    SpellDatabase spells;
+    EnemyDatabase enemies;
+    eventDatabase events;
+    locationDatabase locations;
+
+    GameData() = default;
+    explicit GameData(const string& contentFile);
+};
+
+// Every table the data files and blobs cover, in blob order, as
+// f(fileStem, database, rows, text, nameField); text is the rows' cold half, row for row.
+template <class Data, class F>
+void forEachContentTable(Data& data, F&& f) {
+    f("classes", data.classes, data.classes.templates, data.classes.lore, &PlayerClassTemplate::name);
+    f("races", data.races, data.races.templates, data.races.lore, &PlayerRaceTemplate::name);
+    f("foods", data.foods, data.foods.getFoodAndDrink(), data.foods.getFoodAndDrinkText(),
+      &FoodandDrinksDatabase::FoodsandDrinksProperties::name);
+    f("potions", data.potions, data.potions.getPotions(), data.potions.getPotionText(), &PotionDatabase::potionProperties::name);
+    f("equipment", data.equipment, data.equipment.getEquipment(), data.equipment.getEquipmentText(),
+      &EquipmentandWeaponDatabase::equipmentProperties::name);
+    f("debuffs", data.debuffs, data.debuffs.getDebuffs(), data.debuffs.getDebuffText(), &DebuffDatabase::DebuffDefinition::name);
+    f("spells", data.spells, data.spells.getSpells(), data.spells.getSpellText(), &SpellDatabase::SpellData::spellName);
+    f("enemies", data.enemies, data.enemies.templates, data.enemies.text, &EnemyDatabase::EnemyTemplate::name);
+    f("events", data.events, data.events.getEvents(), data.events.getEventText(), &eventDatabase::eventProperties::name);
+    f("locations", data.locations, data.locations.getLocations(), data.locations.getLocationText(),
+      &locationDatabase::locationProperties::name);
+}
+
+// Loads every table from a blob written by packdata; an empty path keeps the built-in tables.
+inline GameData::GameData(const string& contentFile) {
+    if (contentFile.empty()) return;
+    blob = ContentBlob(contentFile);
+    size_t table = 0;
+    forEachContentTable(*this, [&](const char*, auto& database, const auto& rows, const auto& text, auto name) {
+        using Record = typename std::decay_t<decltype(rows)>::value_type;
+        using Text = typename std::decay_t<decltype(text)>::value_type;
+        ContentBlob::Loaded<Record, Text> loaded = blob.load<Record, Text>(table++, name);
+        database.load(loaded.rows, loaded.text, loaded.byName);
+    });
+}
+
+// The blob gameData() loads on first use; drivers set it from --data before touching content.
+inline string& contentFile() {
+    static string path;
+    return path;
+}
+
+inline const GameData& gameData() {
+    static const GameData data(contentFile());
+    return data;
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <optional>
+#include <chrono>
+#include <cctype>
+#include <thread>
+#include <future>
+#include <set>
+#include <map>
+#include <functional>
+#include <cstdlib>
+#include <stdexcept>
+
+using std::string;
+using std::endl;
+
+// Every screen in the engine reads and writes through this port instead of cin/cout,
+// so the same game logic can be driven by the console, a script or a benchmark.
+class GameIO {
+public:
+    virtual std::ostream& out() = 0;
+    virtual string readLine() = 0;
+    virtual void clearScreen() = 0;
+    virtual ~GameIO() = default;
+};
+
+struct InputClosed : std::runtime_error {
+    InputClosed() : std::runtime_error("Input closed") {}
+};
+
+// Feeds a fixed list of input lines and swallows output unless a transcript stream is given.
+class ScriptedIO : public GameIO {
+public:
+    ScriptedIO(const std::vector<string>& scriptLines, std::ostream* transcriptStream = nullptr)
+        : lines(scriptLines), nextLine(0), transcript(transcriptStream), nullStream(nullptr) {}
+
+    std::ostream& out() override { return transcript ? *transcript : nullStream; }
+
+    string readLine() override {
+        if (nextLine >= lines.size()) throw InputClosed();
+        return lines[nextLine++];
+    }
+
+    void clearScreen() override {}
+
+    size_t linesConsumed() const { return nextLine; }
+
+private:
+    std::vector<string> lines;
+    size_t nextLine;
+    std::ostream* transcript;
+    std::ostream nullStream;
+};
+
+inline GameIO*& currentGameIO() {
+    thread_local GameIO* io = nullptr;
+    return io;
+}
+
+inline GameIO& gameIO() {
+    GameIO* io = currentGameIO();
+    if (!io) throw std::logic_error("No GameIO bound to this thread");
+    return *io;
+}
+
+// Binds a port to the calling thread for the lifetime of the scope.
+class GameIOScope {
+public:
+    GameIOScope(GameIO& io) : previous(currentGameIO()) { currentGameIO() = &io; }
+    ~GameIOScope() { currentGameIO() = previous; }
+    GameIOScope(const GameIOScope&) = delete;
+    GameIOScope& operator=(const GameIOScope&) = delete;
+
+private:
+    GameIO* previous;
+};
+
+inline std::ostream& gameOut() { return gameIO().out(); }
+inline string getLineInput() { return gameIO().readLine(); }
+inline void clearScreen() { gameIO().clearScreen(); }
+inline void waitForEnter() { gameIO().readLine(); }
+
+inline char getCharInput() {
+    string input = getLineInput();
+    for (char c : input) {
+        if (!std::isspace(static_cast<unsigned char>(c))) return c;
+    }
+    return '\0';
+}
+
+inline void displayBorderedMenu(const std::vector<string>& lines, const string& prompt = "Choose an option: ") {
+    size_t maxWidth = 0;
+    for (const auto& line : lines) {
+        maxWidth = std::max(maxWidth, line.length());
+    }
+    string border = string(maxWidth, '=');
+    gameOut() << border << endl;
+    for (const auto& line : lines) {
+        gameOut() << line << string(maxWidth - line.length(), ' ') << endl;
+    }
+    gameOut() << border << endl;
+    gameOut() << prompt;
+}
+
+class PagedSelector {
+public:
+   
+    PagedSelector(const std::vector<string>& itemList, size_t pageSizeParam = 5)
+        : items(itemList), pageSize(pageSizeParam), pageStart(0) {}
+
+    size_t select() {
+        size_t selectedIndex = 0;
+        bool choosing = true;
+
+        while (choosing) {
+            size_t pageEnd = std::min<size_t>(pageStart + pageSize, items.size());
+
+            for (size_t i = pageStart; i < pageEnd; ++i) {
+                gameOut() << i + 1 << ". " << items[i] << endl;
+            }
+
+            gameOut() << "Enter number to select, or input a number out of range to scroll (negative for prev, >" << items.size() << " for next):" << endl;
+            string input = getLineInput();
+
+            int choice = 0;
+            try {
+                choice = std::stoi(input);
+            } catch (...) {
+                gameOut() << "Invalid input! Enter a number.\n";
+                continue;
+            }
+
+            if (choice < 1) {
+               
+                if (pageStart > 0) {
+                    pageStart = std::max<size_t>(0, pageStart - pageSize);
+                } else {
+                    gameOut() << "Already on first page.\n";
+                }
+            } else if (choice > static_cast<int>(items.size())) {
+               
+                if (pageStart + pageSize < items.size()) {
+                    pageStart += pageSize;
+                } else {
+                    gameOut() << "Already on last page.\n";
+                }
+            } else if (choice > static_cast<int>(pageEnd) || choice <= static_cast<int>(pageStart)) {
+               
+                pageStart = (static_cast<size_t>(choice) - 1) / pageSize * pageSize;
+            } else {
+                selectedIndex = static_cast<size_t>(choice) - 1;
+                choosing = false;
+            }
+        }
+
+        return selectedIndex;
+    }
+
+private:
+    std::vector<string> items;
+    size_t pageSize;
+    size_t pageStart;
+};
+
+inline int getNumberInput(int min, int max) {
+    while (true) {
+        string input = getLineInput();
+
+        try {
+            int choice = std::stoi(input); 
+            if (choice >= min && choice <= max)
+                return choice;
+            else
+                gameOut() << "Please enter a number between " << min << " and " << max << ": ";
+        } catch (...) {
+            gameOut() << "Invalid input! Enter a number: ";
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Tables.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+// Small integer handle for one kind of named content. The value is the record's index in its
+// database, so following an id is an array read; names only come back when something is shown.
+template <class Tag>
+struct ContentId {
+    static constexpr uint16_t none = 0xFFFF;
+
+    uint16_t value = none;
+
+    constexpr ContentId() = default;
+    constexpr explicit ContentId(size_t index) : value(static_cast<uint16_t>(index)) {}
+
+    constexpr bool valid() const { return value != none; }
+    constexpr size_t index() const { return value; }
+
+    friend constexpr bool operator==(ContentId a, ContentId b) { return a.value == b.value; }
+    friend constexpr bool operator!=(ContentId a, ContentId b) { return a.value != b.value; }
+    friend constexpr bool operator<(ContentId a, ContentId b) { return a.value < b.value; }
+};
+
+using DebuffId = ContentId<struct DebuffTag>;
+using SpellId = ContentId<struct SpellTag>;
+using EnemyId = ContentId<struct EnemyTag>;
+using EquipmentId = ContentId<struct EquipmentTag>;
+using LocationId = ContentId<struct LocationTag>;
+using EventId = ContentId<struct EventTag>;
+
+// The names of one database in record order. Names are views into the constexpr tables and
+// lookups go through the table's compile-time NameIndex, so nothing is copied or hashed. A name
+// that appears on several records (the equipment list repeats a few weapons) resolves to the
+// first of them.
+template <class Id>
+class NameTable {
+public:
+    explicit NameTable(NameLookup byName) : index(byName) {}
+
+    void add(std::string_view name) {
+        firstRecord.push_back(find(name));
+        names.push_back(name);
+    }
+
+    // Id for a name, or an invalid id when nothing is called that.
+    Id find(std::string_view name) const {
+        size_t record = index.find(name);
+        return record == NameLookup::none ? Id() : Id(record);
+    }
+
+    // The id every record with the same name shares, e.g. for "has bought one of these" sets.
+    Id canonical(Id id) const { return firstRecord[id.index()]; }
+
+    std::string_view name(Id id) const { return names[id.index()]; }
+    size_t size() const { return names.size(); }
+
+private:
+    std::vector<std::string_view> names;
+    std::vector<Id> firstRecord;
+    NameLookup index;
+};
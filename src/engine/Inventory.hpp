@@ -0,0 +1,473 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Names.hpp"
+#include "SlotMap.hpp"
+#include "TimingWheel.hpp"
+
+#include <unordered_map>
+
+class PlayerInventory {
+public:
+    enum class ItemType { Potion, Equipment, FoodAndDrink };
+
+    struct InventoryItem {
+        ItemType type;
+        size_t dbIndex;
+        int quantity;
+        bool enchanted = false;
+    };
+
+    // Stays valid while its stack exists, however the inventory is reordered around it.
+    using ItemHandle = SlotHandle;
+
+    // New stacks go to the bottom of the list; adding to an existing stack keeps its place.
+    ItemHandle addItem(ItemType type, size_t dbIndex, int amount = 1) {
+        auto [entry, added] = stacks.try_emplace(stackKey(type, dbIndex));
+        if (!added) {
+            items.get(entry->second)->quantity += amount;
+            return entry->second;
+        }
+        entry->second = items.pushBack({ type, dbIndex, amount });
+        return entry->second;
+    }
+
+    // The stack holding this item, or an invalid handle when there is none.
+    ItemHandle findItem(ItemType type, size_t dbIndex) const {
+        auto entry = stacks.find(stackKey(type, dbIndex));
+        return entry == stacks.end() ? ItemHandle() : entry->second;
+    }
+
+    void removeItem(ItemHandle handle) {
+        const InventoryItem* item = items.get(handle);
+        if (!item) return;
+        stacks.erase(stackKey(item->type, item->dbIndex));
+        items.erase(handle);
+    }
+
+    void showInventory(Player& player) {
+        if (items.empty()) {
+            gameOut() << "Inventory is empty.\n";
+            waitForEnter();
+            return;
+        }
+
+        std::vector<string> lines;
+        std::vector<ItemHandle> shown;
+        items.forEach([&](ItemHandle handle, const InventoryItem& item) {
+            string itemLine = std::to_string(shown.size() + 1) + ". " + getItemName(item);
+            if (isEquipped(handle)) {
+                itemLine += " (Equipped";
+                if (item.enchanted) {
+                    itemLine += ", Enchanted";
+                }
+                itemLine += ")";
+            }
+            if (item.enchanted && !isEquipped(handle)) {
+                itemLine += " [Enchanted]";
+            }
+            itemLine += " x" + std::to_string(item.quantity);
+            lines.push_back(itemLine);
+            shown.push_back(handle);
+        });
+
+        displayBorderedMenu(lines, "Choose item (0 to exit): ");
+        int choice = getNumberInput(0, static_cast<int>(shown.size()));
+
+        if (choice <= 0 || choice > static_cast<int>(shown.size())) return;
+
+        handleSelectedItem(player, shown[static_cast<size_t>(choice - 1)]);
+    }
+
+    // One combat round passes. Only the buffs whose time is up are touched, however many are active.
+    void tickBuffs(Player& player) {
+        if (buffs.empty()) return;
+
+        std::vector<std::string_view> wornOff;
+        buffExpiry.advance([&](BuffHandle handle) {
+            const Buff* buff = buffs.get(handle);
+            if (!buff || buff->expiresAt != buffExpiry.now()) return; // refreshed since
+            wornOff.push_back(buff->name);
+            buffs.erase(handle);
+        });
+        if (wornOff.empty()) return;
+
+        applyBuffs(player);
+        for (std::string_view name : wornOff) {
+            gameOut() << name << " has worn off.\n";
+        }
+    }
+
+private:
+    struct Buff {
+        std::string_view name;
+        int attackBonus = 0;
+        int defenseBonus = 0;
+        int magicAttackBonus = 0;
+        int magicDefenseBonus = 0;
+        int maxManaBonus = 0;
+        float critRateBonus = 0.0f;
+        float critDamageBonus = 0.0f;
+        int remainingTurns = 0;
+        uint64_t expiresAt = 0; // buffExpiry turn
+
+        Buff() = default;
+        Buff(std::string_view n, int ab, int db, int mab, int mdb, int mmb, float crb, float cdb, int rt)
+            : name(n), attackBonus(ab), defenseBonus(db), magicAttackBonus(mab), magicDefenseBonus(mdb), maxManaBonus(mmb), critRateBonus(crb), critDamageBonus(cdb), remainingTurns(rt) {}
+    };
+    using BuffHandle = SlotHandle;
+
+public:
+    // Every active buff summed into one, with the turns left until the first wears off;
+    // empty when none is active.
+    std::optional<Buff> getActiveBuff() const {
+        if (buffs.empty()) return std::nullopt;
+        Buff total;
+        uint64_t soonest = UINT64_MAX;
+        buffs.forEach([&](BuffHandle, const Buff& buff) {
+            total.attackBonus += buff.attackBonus;
+            total.defenseBonus += buff.defenseBonus;
+            total.magicAttackBonus += buff.magicAttackBonus;
+            total.magicDefenseBonus += buff.magicDefenseBonus;
+            total.maxManaBonus += buff.maxManaBonus;
+            total.critRateBonus += buff.critRateBonus;
+            total.critDamageBonus += buff.critDamageBonus;
+            soonest = std::min(soonest, buff.expiresAt);
+        });
+        total.remainingTurns = static_cast<int>(soonest - buffExpiry.now());
+        return total;
+    }
+
+    size_t activeBuffCount() const { return buffs.size(); }
+
+    // Handles of the equipped stacks; invalid for an empty slot.
+    struct EquippedSlots {
+        ItemHandle armor;
+        ItemHandle weapon;
+        ItemHandle staff;
+    };
+
+    // Display order is the slot map's own list; stacks indexes it by (type, dbIndex).
+    SlotMap<InventoryItem> items;
+    std::unordered_map<uint64_t, ItemHandle> stacks;
+    EquippedSlots equipped;
+    SlotMap<Buff> buffs;
+    TimingWheel<BuffHandle> buffExpiry; // turns are combat rounds, advanced by tickBuffs
+
+    const PotionDatabase& potionDB = gameData().potions;
+    const EquipmentandWeaponDatabase& equipmentDB = gameData().equipment;
+    const FoodandDrinksDatabase& foodDB = gameData().foods;
+    const SpellDatabase& spellDB = gameData().spells;
+
+    string getItemName(const InventoryItem& item) const {
+        if (item.type == ItemType::Potion)
+            return string(potionDB.getPotions()[item.dbIndex].name);
+        else if (item.type == ItemType::Equipment)
+            return string(equipmentDB.getEquipment()[item.dbIndex].name);
+        else if (item.type == ItemType::FoodAndDrink)
+            return string(foodDB.getFoodAndDrink()[item.dbIndex].name);
+        else
+            return "Unknown Item";
+    }
+
+    bool isWeapon(const EquipmentandWeaponDatabase::equipmentProperties& eq) const {
+        return eq.attackIncrease > 0 || eq.magicAttackIncrease > 0;
+    }
+
+    static uint64_t stackKey(ItemType type, size_t dbIndex) {
+        return (static_cast<uint64_t>(type) << 32) | static_cast<uint64_t>(dbIndex);
+    }
+
+    bool isEquipped(ItemHandle handle) const {
+        return handle.valid() && (equipped.armor == handle || equipped.weapon == handle || equipped.staff == handle);
+    }
+
+    // Equipment table row of the stack in an equipped slot, or nullptr for an empty slot.
+    const EquipmentandWeaponDatabase::equipmentProperties* equippedItem(ItemHandle slot) const {
+        const InventoryItem* item = items.get(slot);
+        return item ? &equipmentDB.getEquipment()[item->dbIndex] : nullptr;
+    }
+
+    void handleSelectedItem(Player& player, ItemHandle handle) {
+        const InventoryItem& item = *items.get(handle);
+        if (item.type == ItemType::Potion)
+            usePotion(player, handle);
+        else if (item.type == ItemType::FoodAndDrink)
+            useFoodAndDrink(player, handle);
+        else
+            equipItem(player, handle);
+    }
+
+    // Uses up one of the stack, dropping it once empty.
+    void consumeItem(ItemHandle handle) {
+        InventoryItem* item = items.get(handle);
+        if (item && --item->quantity <= 0) removeItem(handle);
+    }
+
+    void usePotion(Player& player, ItemHandle handle) {
+        const size_t dbIndex = items.get(handle)->dbIndex;
+        const auto& potion = potionDB.getPotions()[dbIndex];
+
+        gameOut() << "Use " << potion.name << "? (y/n): ";
+        char c = getCharInput();
+        if (c != 'y') return;
+
+    
+        if (potion.hpEffect > 0) {
+            int heal = std::min(potion.hpEffect, player.stats.maxHitpoints - player.stats.hitpoints);
+            player.stats.hitpoints += heal;
+            gameOut() << "Recovered " << heal << " HP.\n";
+        }
+
+        
+        if (potion.manaRestore > 0) {
+            int restore = std::min(potion.manaRestore, player.stats.maxMana - player.stats.mana);
+            player.stats.mana += restore;
+            gameOut() << "Recovered " << restore << " Mana.\n";
+        }
+
+     
+        if (potion.durationTurns > 0) {
+            addBuff(player, Buff{
+                potion.name,
+                potion.attackEffect,
+                potion.defenseEffect,
+                potion.magicEffect,
+                potion.magicDefenseEffect,
+                potion.manaIncreaseMax,
+                potion.critRateEffect,
+                potion.critDamageEffect,
+                potion.durationTurns
+            });
+            if (potion.manaIncreaseMax > 0) {
+                player.stats.mana += potion.manaIncreaseMax;
+            }
+
+            gameOut() << potionDB.getPotionText()[dbIndex].effectDesc << endl;
+        }
+
+        consumeItem(handle);
+    }
+
+    void useFoodAndDrink(Player& player, ItemHandle handle) {
+        const auto& food = foodDB.getFoodAndDrink()[items.get(handle)->dbIndex];
+
+        gameOut() << "Use " << food.name << "? (y/n): ";
+        char c = getCharInput();
+        if (c != 'y') return;
+
+    
+        if (food.healthRestoration > 0) {
+            int heal = std::min(food.healthRestoration, player.stats.maxHitpoints - player.stats.hitpoints);
+            player.stats.hitpoints += heal;
+            gameOut() << "Recovered " << heal << " HP.\n";
+        }
+
+     
+        if (food.manaRestoration > 0) {
+            int restore = std::min(food.manaRestoration, player.stats.maxMana - player.stats.mana);
+            player.stats.mana += restore;
+            gameOut() << "Recovered " << restore << " Mana.\n";
+        }
+
+   
+        Stats lasting = player.statLayers.layer(StatLayer::Food);
+        if (food.maxHealthBuffBonus > 0) {
+            lasting.maxHitpoints += food.maxHealthBuffBonus;
+            gameOut() << "Max HP increased by " << food.maxHealthBuffBonus << ".\n";
+        }
+
+        if (food.maxManaBuffBonus > 0) {
+            lasting.maxMana += food.maxManaBuffBonus;
+            gameOut() << "Max Mana increased by " << food.maxManaBuffBonus << ".\n";
+        }
+        player.setStatLayer(StatLayer::Food, lasting);
+
+        consumeItem(handle);
+    }
+
+    void equipItem(Player& player, ItemHandle handle) {
+        const size_t dbIndex = items.get(handle)->dbIndex;
+        const auto& eq = equipmentDB.getEquipment()[dbIndex];
+        bool weapon = isWeapon(eq);
+        bool staff = eq.type == "Staff";
+        bool alreadyEquipped = isEquipped(handle);
+
+        if (alreadyEquipped) {
+            gameOut() << "Unequip " << eq.name << "? (y/n): ";
+            char c = getCharInput();
+            if (c != 'y') return;
+
+            if (staff) unequipStaff(player);
+            else if (weapon) unequipWeapon(player);
+            else unequipArmor(player);
+            gameOut() << eq.name << " unequipped.\n";
+            return;
+        }
+
+   
+        gameOut() << "Equip " << eq.name << "? (y/n): ";
+        char c = getCharInput();
+        if (c != 'y') return;
+
+        if (staff) equipStaff(player, handle);
+        else if (weapon) equipWeapon(player, handle);
+        else equipArmor(player, handle);
+
+        moveItemToTop(handle);
+
+        gameOut() << equipmentDB.getEquipmentText()[dbIndex].effectDesc << endl;
+    }
+
+    // Starts a timed buff; drinking a potion that is still active restarts its timer instead of
+    // stacking a second copy. The old timer entry is left to find a newer expiry and skip.
+    void addBuff(Player& player, Buff buff) {
+        buff.expiresAt = buffExpiry.now() + static_cast<uint64_t>(std::max(1, buff.remainingTurns));
+        BuffHandle existing;
+        buffs.forEach([&](BuffHandle handle, const Buff& active) {
+            if (active.name == buff.name) existing = handle;
+        });
+        if (Buff* active = buffs.get(existing)) {
+            *active = buff;
+        } else {
+            existing = buffs.pushBack(buff);
+        }
+        buffExpiry.schedule(buff.expiresAt - buffExpiry.now(), existing);
+        applyBuffs(player);
+    }
+
+    // The Buffs stat layer is the sum of every active buff.
+    void applyBuffs(Player& player) const {
+        Stats bonus{};
+        buffs.forEach([&](BuffHandle, const Buff& buff) {
+            bonus.attack += buff.attackBonus;
+            bonus.armor += static_cast<float>(buff.defenseBonus);
+            bonus.magicAttack += buff.magicAttackBonus;
+            bonus.magicArmor += static_cast<float>(buff.magicDefenseBonus);
+            bonus.maxMana += buff.maxManaBonus;
+            bonus.critRate += buff.critRateBonus;
+            bonus.critDamage += buff.critDamageBonus;
+        });
+        player.setStatLayer(StatLayer::Buffs, bonus);
+    }
+
+    // Rebuilds the Gear and StaffSpells layers from whatever the slots hold now.
+    void refreshGear(Player& player) const {
+        Stats gear{};
+        Stats staffSpells{};
+        if (const auto* eq = equippedItem(equipped.armor)) {
+            gear.armor += static_cast<float>(eq->defenseIncrease);
+            gear.magicArmor += static_cast<float>(eq->magicDefenseIncrease);
+        }
+        if (const auto* eq = equippedItem(equipped.weapon)) {
+            gear.attack += eq->attackIncrease;
+            gear.magicAttack += eq->magicAttackIncrease;
+        }
+        if (const auto* eq = equippedItem(equipped.staff)) {
+            gear.magicAttack += eq->magicAttackIncrease;
+            for (SpellId spellId : player.equippedStaffSpells) {
+                const auto& spell = spellDB.getSpells()[spellId.index()];
+                staffSpells.magicAttack += static_cast<int>(std::round(spell.healthDamage * spell.staffBonusModifier));
+            }
+        }
+        player.statLayers.set(StatLayer::Gear, gear);
+        player.statLayers.set(StatLayer::StaffSpells, staffSpells);
+        player.statLayers.resolve(player.stats);
+    }
+
+    void equipArmor(Player& player, ItemHandle handle) {
+        equipped.armor = handle;
+        refreshGear(player);
+    }
+
+    void equipWeapon(Player& player, ItemHandle handle) {
+        const size_t dbIndex = items.get(handle)->dbIndex;
+        player.equippedWeaponDebuffs = nameRegistry().weaponDebuffs[dbIndex];
+        player.equippedWeaponDebuffChance = equipmentDB.getEquipment()[dbIndex].debuffChance;
+        equipped.weapon = handle;
+        refreshGear(player);
+    }
+
+    void unequipArmor(Player& player) {
+        equipped.armor = ItemHandle();
+        refreshGear(player);
+    }
+
+    void unequipWeapon(Player& player) {
+        if (!equipped.weapon.valid()) return;
+        player.equippedWeaponDebuffs.clear();
+        player.equippedWeaponDebuffChance = 0.0f;
+        equipped.weapon = ItemHandle();
+        refreshGear(player);
+    }
+
+    void equipStaff(Player& player, ItemHandle handle) {
+        equipped.staff = handle;
+        refreshGear(player);
+    }
+
+    void unequipStaff(Player& player) {
+        equipped.staff = ItemHandle();
+        refreshGear(player);
+    }
+
+    void moveItemToTop(ItemHandle handle) {
+        items.moveToFront(handle);
+    }
+};
+
+class PlayerController {
+public:
+    PlayerController(Player& p, PlayerInventory& inv)
+        : player(p), inventory(inv), reqAmount(100) {}
+
+    void showStats() const {
+        gameOut() << "\n=== Player Stats ===" << endl;
+        gameOut() << "Hitpoints: " << player.stats.hitpoints << "/" << player.stats.maxHitpoints << endl;
+
+        auto activeBuff = inventory.getActiveBuff();
+        if (activeBuff) {
+            const char* source = inventory.activeBuffCount() == 1 ? " from a potion, (" : " from potions, (";
+            gameOut() << "Armor: " << player.stats.armor
+                 << "( + " << activeBuff->defenseBonus << source << activeBuff->remainingTurns << " turns left))" << endl;
+            gameOut() << "Magic Armor: " << player.stats.magicArmor
+                 << "( + " << activeBuff->magicDefenseBonus << source << activeBuff->remainingTurns << " turns left))" << endl;
+            gameOut() << "Attack: " << player.stats.attack
+                 << "( + " << activeBuff->attackBonus << source << activeBuff->remainingTurns << " turns left))" << endl;
+            gameOut() << "Magic Attack: " << player.stats.magicAttack
+                 << "( + " << activeBuff->magicAttackBonus << source << activeBuff->remainingTurns << " turns left))" << endl;
+        } else {
+            gameOut() << "Armor: " << player.stats.armor << endl;
+            gameOut() << "Magic Armor: " << player.stats.magicArmor << endl;
+            gameOut() << "Attack: " << player.stats.attack << endl;
+            gameOut() << "Magic Attack: " << player.stats.magicAttack << endl;
+        }
+
+        gameOut() << "Level: " << player.stats.level << endl;
+        gameOut() << "Experience: " << player.stats.expe << "/" << reqAmount << endl;
+        gameOut() << "Currency: " << player.economy.toString() << endl;
+        gameOut() << "\nPress Enter to continue...";
+        waitForEnter();
+    }
+
+    void levelUpChecker() {
+        while (player.stats.expe >= reqAmount) {
+            player.stats.expe -= reqAmount;
+            player.stats.level += 1;
+
+
+            player.gainLevel();
+
+
+            reqAmount *= 1.2f;
+
+            gameOut() << "You leveled Up!" << endl;
+            gameOut() << "Your stats have been increased by 10%." << endl;
+        }
+    }
+
+private:
+    Player& player;
+    PlayerInventory& inventory;
+    float reqAmount;
+};
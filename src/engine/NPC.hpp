@@ -0,0 +1,421 @@
+#pragma once
+
+#include "GameData.hpp"
+
+// The text generated NPCs are made from. It is shared and never copied: an NPC keeps the indices
+// of its story and dialogue lines, and its kit and gear are views into this or the content tables.
+struct NPCText {
+    static constexpr auto firstNames = tableOf<std::string_view>({
+        "Godfrey", "Augustus", "Edmund", "Alfred", "Theodore",
+        "Marcus", "Julius", "Lucius", "Constantine", "Benedict",
+        "Sebastian", "Cornelius", "Ambrose", "Gregory", "Leonard",
+        "Matthias", "Philip", "Alexander", "Dominic", "Victor",
+        "Hugh", "Gerald", "Roland", "Bernard", "Percival",
+    });
+    static constexpr auto lastNames = tableOf<std::string_view>({
+        "Janus", "Godwin", "Edwards", "Aurelian", "Constantinus",
+        "Benedictus", "Marcellus", "Valerian", "Justinian", "Hadrian",
+        "Maximus", "Cassius", "Severus", "Flavian", "Gratian",
+        "Laurentius", "Paulinus", "Victorinus", "Dominicus", "Magnus",
+        "Theodoric", "Regulus", "Claudius", "Tiberius", "Germanicus",
+    });
+    static constexpr auto specialCharacters = tableOf<std::string_view>({
+        "Evelyn Chevalier", "Astra Yao", "Ye Shunguang ", "Burnice White", "Jane Doe", "Belle",
+    });
+
+    static constexpr auto stories = tableOf<std::string_view>({
+        "I arrived here following the migration of the birds. I figured if they were heading south to find something better, I might as well see where the path led me. I haven't found a reason to turn back yet.",
+        "A heavy flood took my family's land three summers ago. With nothing left to pull from the mud, I packed what could fit in a single satchel and started walking. This was the first place that felt solid enough to stop.",
+        "I was part of a caravan that got caught in a mountain pass during a blizzard. By the time the snow cleared, the group had split up. I took the downhill trail, and it eventually opened up into the gates of this place.",
+        "To be honest, I left my home because the silence was getting too loud. Every day was exactly like the one before it, and I realized if I didn't leave then, I would eventually become part of the scenery. So, I walked.",
+        "I followed a map I found tucked inside an old book. It didn't lead to gold or glory like I'd hoped—just a long, winding road that ended right here. Perhaps the map wasn't about the destination, but just the exit.",
+        "My journey started with a simple disagreement with the local magistrate. It was easier to vanish into the night than to stay and argue a point that no one wanted to hear. I've been a stranger in new lands ever since.",
+        "I came here looking for someone I used to know. I've since realized they are long gone, but by the time I figured that out, I had already grown fond of the way the morning sun hits the buildings in this square.",
+        "The wind seemed to push me here. Every time I reached a crossroads and felt uncertain, a gust would pick up from the north or the west, nudging me along. I stopped here because, for once, the air went still.",
+        "I grew up on the back of a wagon, always moving. When I finally reached this place, my boots were worn through and my spirit was tired. I decided then that I was done with the road for a while.",
+        "I left home when the inheritance was divided and there was nothing left for the youngest but a sturdy pair of shoes and a blessing. I’ve used the shoes well, and I suppose the blessing brought me here safely.",
+        "There was a fire in my old village—not a raid, just a stray spark on a dry night. Most of us scattered to the neighboring valleys. I kept going a bit further than the rest, wanting a fresh start where no one knew my name.",
+        "I was traveling with a troupe of performers until our wagon broke an axle ten miles back. They stayed to fix it, but I decided to keep walking. I think I was just ready to see the world at my own pace.",
+        "I came here by sea, tucked away in the corner of a merchant's hull. The salt air was all I knew for a month, and when I finally stepped onto the docks here, the ground felt so steady I didn't want to leave it.",
+        "I spent years looking for a specific tree I saw in a dream as a child. I haven't found the tree yet, but the path I took trying to find it brought me through these gates, and it felt right to stay.",
+        "I simply walked out of my front door one morning and forgot to turn around. By the time I realized how far I’d gone, the horizon behind me looked just as unfamiliar as the one ahead. So, I kept going until I hit this spot.",
+    });
+
+    static constexpr size_t normalDialogueCount = 15;
+    static constexpr auto dialogues = tableOf<std::string_view>({
+        // Anyone; an NPC gets two or three of these
+        "The air feels a bit heavy today. I wouldn't be surprised if we saw a bit of rain before sunset.",
+        "It's a quiet afternoon, isn't it? Sometimes the silence is exactly what a person needs.",
+        "I was just thinking about how much the light changes the look of these old stone walls.",
+        "Have you been this way before? It feels like every time I turn a corner, I notice something new.",
+        "The days seem to be getting shorter. It'll be dark before we know it.",
+        "I wonder what lies beyond those hills. Most people are content to stay put, but I always find myself looking outward.",
+        "It's nice to see a friendly face. This place can feel a bit hollow when the crowds thin out.",
+        "I heard a bird singing earlier that I didn't recognize. It's funny how the small things stick with you.",
+        "Do you ever get the feeling that time moves slower in some places than it does in others?",
+        "I was just resting my eyes for a moment. It's been a long day, even if I haven't done much.",
+        "There's something comforting about the smell of woodsmoke in the evening, don't you think?",
+        "I've spent a lot of time just watching people pass by. Everyone seems to be in such a hurry to get somewhere.",
+        "The ground is a bit uneven here. You'd think they would have leveled these stones centuries ago.",
+        "I'm not looking for much just a bit of shade and a moment to catch my breath.",
+        "If you're heading further down the road, keep an eye on the clouds. They look like they're shifting.",
+        // Evelyn Chevalier
+        "It'll be my duty to ensure your safety.",
+        "Hm? It's just me you need, and not a bodyguard...? I see.",
+        "Have you noticed? People on the street may all appear to be similar, but they actually have subtle differences.",
+        "Don't worry. I'm right behind you.",
+        "What's the matter? Something on your mind?",
+        "I'm used to people staring at me while I'm working.",
+        // Astra Yao
+        "There's no need for disguises. We're heading out into the world with confidence!",
+        "Want me to hold your hand? I don't care if anyone sees.",
+        "As long as you're just daydreaming...",
+        "I want to find somewhere to sit down...",
+        "Have you decided where we're going next? Time is of the essence.",
+        // Ye Shunguang
+        "If you ever want to go out for a walk, just let me know!",
+        "You're here! Shall we head out now?",
+        "The weather's always so nice when I'm out with you~",
+        "Where'd you wanna go, Junior? I'll follow your lead.",
+        "Stop spacing out... Come on, take my hand. Let's keep going.",
+        "If only time could stop at this moment...",
+        // Burnice White
+        "Hey, you lookin' for me? C'mon, who else would you be lookin' for?!",
+        "Ooh! Where we going? Oh, you should show me around your neighborhood!",
+        "Hm? Did something spark your interest?",
+        "What's up? See someone you know?",
+        "And even if there were crumbs, they would've been blown away on the ride here!",
+        "You're not... getting tired already, are ya?",
+        // Jane Doe
+        " Hey there~ It's been a while. I've been looking forward to seeing you.",
+        "So, where'd you wanna go? I'm down for anything~",
+        "Hey, you're not moving... \n Are you pretending to be a statue?",
+        "Feeling tired already? I can carry you the rest of the way~",
+        "If you keep staring at me like that, I might actually get embarrassed... \nJust kidding~",
+        "Why are you staring at me? Do I have something on my face?",
+        // Belle
+        "So sleepy... Brain feels so foggy... Coffee... I need coffee....",
+        "Wouldn't it be weird if I'm a vampire and you are human? ,I might bite you first... Wait, did you turn me into a vampire? when i was sleeping?",
+        "I just realized I haven't played guitar for a long time.",
+        "Is it really all up to me? I'm so glad you trust me with running the party! I will not let you down!",
+        "Why do I crave Caramel Boba Oolong Teamilk in the middle of this quiet day?",
+        "Makes me wonder why I even bother with trying to save the money. You don't feel this way?",
+    });
+
+    // The lines of each special character, parallel to specialCharacters.
+    struct LineRange {
+        uint8_t first;
+        uint8_t count;
+    };
+    static constexpr auto specialDialogues = tableOf<LineRange>({
+        {15, 6}, // Evelyn Chevalier
+        {21, 5}, // Astra Yao
+        {26, 6}, // Ye Shunguang
+        {32, 6}, // Burnice White
+        {38, 6}, // Jane Doe
+        {44, 6}, // Belle
+    });
+
+    static constexpr auto startingKit = tableOf<std::string_view>({
+        "Small Health Potion", "Small Health Potion", "Small Health Potion",
+        "Small Mana Potion", "Small Mana Potion", "Small Mana Potion",
+    });
+};
+
+// Which spells an NPC of a given level may know, in spell table order, built once from the loaded
+// spells; any level past the highest requirement knows them all.
+class NPCSpellTable {
+public:
+    explicit NPCSpellTable(const SpellDatabase& spells) {
+        int highest = 0;
+        for (const auto& spell : spells.getSpells()) highest = std::max(highest, spell.requiredLevel);
+        byLevel.resize(static_cast<size_t>(highest) + 1);
+        for (int level = 0; level <= highest; ++level) {
+            for (size_t i = 0; i < spells.getSpells().size(); ++i) {
+                if (spells.getSpells()[i].requiredLevel <= level) byLevel[static_cast<size_t>(level)].push_back(SpellId(i));
+            }
+        }
+    }
+
+    const std::vector<SpellId>& eligible(int level) const {
+        return byLevel[static_cast<size_t>(std::clamp(level, 0, static_cast<int>(byLevel.size()) - 1))];
+    }
+
+private:
+    std::vector<std::vector<SpellId>> byLevel;
+};
+
+inline const NPCSpellTable& npcSpellTable() {
+    static const NPCSpellTable table(gameData().spells);
+    return table;
+}
+
+// Hands out ids in [0, count) without repeats, in random order. The free ids sit at the front of
+// a permutation that is shuffled lazily, one Fisher-Yates step per acquire, and every id knows its
+// own position, so acquire, claim and release are all O(1) however full the space is.
+class NameAllocator {
+public:
+    explicit NameAllocator(size_t count) : order(count), position(count), freeCount(count) {
+        for (size_t i = 0; i < count; ++i) order[i] = position[i] = static_cast<uint16_t>(i);
+    }
+
+    size_t available() const { return freeCount; }
+    bool isTaken(size_t id) const { return position[id] >= freeCount; }
+
+    // A random free id, taking one draw from `rng`; throws once every id is taken.
+    size_t acquire(CounterRng& rng) {
+        if (freeCount == 0) throw std::runtime_error("NameAllocator: every name is taken");
+        size_t id = order[rng.below(freeCount)];
+        claim(id);
+        return id;
+    }
+
+    // Takes a specific id; false if it already was.
+    bool claim(size_t id) {
+        if (isTaken(id)) return false;
+        swapPositions(position[id], --freeCount);
+        return true;
+    }
+
+    void release(size_t id) {
+        if (!isTaken(id)) return;
+        swapPositions(position[id], freeCount++);
+    }
+
+private:
+    void swapPositions(size_t a, size_t b) {
+        std::swap(order[a], order[b]);
+        position[order[a]] = static_cast<uint16_t>(a);
+        position[order[b]] = static_cast<uint16_t>(b);
+    }
+
+    std::vector<uint16_t> order;    // free ids first, then taken ones
+    std::vector<uint16_t> position; // where each id sits in order
+    size_t freeCount;
+};
+
+struct NPC {
+    string name;
+    uint16_t nameId; // NPCGenerator's name slot, handed back by releaseName
+    Stats stats;
+    PlayerRace race;
+    PlayerClassTemplate playerClass;
+    int level;
+    FixedList<std::string_view, NPCText::startingKit.size()> inventory;
+    std::string_view equippedWeapon; // names from the equipment table, empty when bare
+    std::string_view equippedArmor;
+    DebuffSet debuffs;
+    FixedList<SpellId, 2> spells;
+    int wagePerWeek;
+    uint8_t story;                    // index into NPCText::stories
+    FixedList<uint8_t, 6> dialogues; // indices into NPCText::dialogues
+
+    std::string_view storyText() const { return NPCText::stories[story]; }
+
+    // One of the NPC's lines, which must have at least one.
+    std::string_view randomDialogue(CounterRng& rng) const {
+        return NPCText::dialogues[dialogues[rng.below(dialogues.size())]];
+    }
+};
+
+// An NPC at rest: the key of the stream its body is drawn from, its name slot and the few fields
+// that change after generation. Race, class, gear, spells and lines are rebuilt from the seed by
+// NPCGenerator::materialize, so a town can keep thousands of these in a few tens of KB.
+struct ResidentNPC {
+    uint64_t seed;
+    uint16_t nameId;
+    uint16_t level;
+    int16_t hitpointsLost; // below the materialized maximum, so a fresh resident needs no body
+    uint16_t wagePerWeek;
+};
+static_assert(sizeof(ResidentNPC) == 16, "ResidentNPC should stay two words");
+
+// Every NPC a generator hands out has a name no other living one has: ordinary names come from the
+// first x last name product, special characters are unique too, and an NPC's name stays taken
+// until releaseName. With the ordinary names used up a special character is drawn instead and
+// the reverse; with both used up generateNPC throws.
+class NPCGenerator {
+public:
+    static constexpr size_t commonNameCount = NPCText::firstNames.size() * NPCText::lastNames.size();
+
+    NPCGenerator() : commonNames(commonNameCount), specialNames(NPCText::specialCharacters.size()) {}
+
+    void releaseName(const NPC& npc) { releaseNameId(npc.nameId); }
+    void releaseName(const ResidentNPC& resident) { releaseNameId(resident.nameId); }
+
+    size_t namesAvailable() const { return commonNames.available() + specialNames.available(); }
+
+    // A named NPC from the thread's random stream: the body first, then the name.
+    NPC generateNPC(int playerLevel) {
+        CounterRng& gen = randomStream();
+        NPC npc = generateCandidate(playerLevel, gen);
+        assignName(npc, gen);
+        return npc;
+    }
+
+    // A named resident from the thread's random stream. Only the level and the name are drawn
+    // here; the body waits for materialize.
+    ResidentNPC generateResident(int playerLevel) {
+        CounterRng& gen = randomStream();
+        uint64_t seed = gen.fork().streamKey();
+        int level = drawLevel(playerLevel, gen);
+        return makeResident(seed, level, drawNameId(gen));
+    }
+
+    // A fresh resident with a name already locked by lockName.
+    static ResidentNPC makeResident(uint64_t seed, int level, uint16_t nameId) {
+        ResidentNPC resident;
+        resident.seed = seed;
+        resident.level = static_cast<uint16_t>(level);
+        resident.nameId = nameId;
+        resident.hitpointsLost = 0;
+        resident.wagePerWeek = static_cast<uint16_t>(baseWage(level) * (isSpecialName(nameId) ? 2 : 1));
+        return resident;
+    }
+
+    // The full NPC a resident stands for. The same resident always gives the same NPC, and
+    // changing its level rebuilds the body for the new level.
+    static NPC materialize(const ResidentNPC& resident) {
+        CounterRng gen(resident.seed);
+        NPC npc = generateBody(resident.level, gen);
+        applyName(npc, resident.nameId);
+        npc.stats.hitpoints = std::max(0, npc.stats.maxHitpoints - resident.hitpointsLost);
+        npc.wagePerWeek = resident.wagePerWeek;
+        return npc;
+    }
+
+    // Everything but the name, drawn from `gen` alone and touching no generator state, so any
+    // thread can build candidates ahead of time (see TavernCandidates).
+    static NPC generateCandidate(int playerLevel, CounterRng& gen) {
+        int level = drawLevel(playerLevel, gen);
+        return generateBody(level, gen);
+    }
+
+    // An NPC of exactly this level, without a name. The pools and the spell table are shared,
+    // not rebuilt per call.
+    static NPC generateBody(int level, CounterRng& gen) {
+        const GameData& data = gameData();
+        const auto& races = data.races.templates;
+        const PlayerRaceTemplate& chosenRace = races[gen.below(races.size())];
+
+        const auto& classes = data.classes.templates;
+        const PlayerClassTemplate& chosenClass = classes[gen.below(classes.size())];
+
+        NPC npc;
+        npc.nameId = 0;
+        npc.race = PlayerRace{chosenRace.name};
+        npc.playerClass = chosenClass;
+        npc.level = level;
+        npc.stats = chosenClass.stats;
+
+        npc.stats.hitpoints += chosenRace.statBonus.hitpoints;
+        npc.stats.maxHitpoints += chosenRace.statBonus.maxHitpoints;
+        npc.stats.armor += chosenRace.statBonus.armor;
+        npc.stats.magicArmor += chosenRace.statBonus.magicArmor;
+        npc.stats.attack += chosenRace.statBonus.attack;
+        npc.stats.magicAttack += chosenRace.statBonus.magicAttack;
+        npc.stats.mana += chosenRace.statBonus.mana;
+        npc.stats.maxMana += chosenRace.statBonus.maxMana;
+
+        float scale = 1.0f + (level - 1) * 0.1f;
+        npc.stats.scale(scale);
+
+        const auto& equipment = data.equipment.getEquipment();
+        const auto& eq = equipment[gen.below(equipment.size())];
+        if (eq.type == "Weapon") {
+            npc.equippedWeapon = eq.name;
+            npc.stats.attack += eq.attackIncrease;
+            npc.stats.magicAttack += eq.magicAttackIncrease;
+        } else {
+            npc.equippedArmor = eq.name;
+            npc.stats.armor += eq.defenseIncrease;
+            npc.stats.magicArmor += eq.magicDefenseIncrease;
+        }
+
+        for (std::string_view item : NPCText::startingKit) npc.inventory.push_back(item);
+
+        npc.wagePerWeek = baseWage(level);
+
+        npc.story = static_cast<uint8_t>(gen.below(NPCText::stories.size()));
+
+        // Two spells in the order a full shuffle of the eligible list leaves them. The scratch
+        // copy is per thread and reused, so this allocates nothing once warm.
+        thread_local std::vector<SpellId> spellScratch;
+        const std::vector<SpellId>& eligible = npcSpellTable().eligible(level);
+        spellScratch.assign(eligible.begin(), eligible.end());
+        gen.shuffle(spellScratch.begin(), spellScratch.end());
+        for (size_t i = 0; i < std::min<size_t>(2, spellScratch.size()); ++i) {
+            npc.spells.push_back(spellScratch[i]);
+        }
+
+        std::array<uint8_t, NPCText::normalDialogueCount> order;
+        for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<uint8_t>(i);
+        gen.shuffle(order.begin(), order.end());
+        int num = gen.range(2, 3);
+        for (int i = 0; i < num; ++i) {
+            npc.dialogues.push_back(order[static_cast<size_t>(i)]);
+        }
+
+        return npc;
+    }
+
+    // Gives a candidate a free name. One in ten is a special character instead, who brings their
+    // own lines and asks double the wage.
+    void assignName(NPC& npc, CounterRng& gen) { applyName(npc, drawNameId(gen)); }
+
+    // Takes a free name slot, a special character's if one was wanted and is left; releaseName
+    // hands it back. Throws when every name is in use.
+    uint16_t lockName(bool wantsSpecial, CounterRng& gen) {
+        if (namesAvailable() == 0) throw std::runtime_error("NPCGenerator: every NPC name is in use");
+        bool isSpecial = specialNames.available() > 0 && (wantsSpecial || commonNames.available() == 0);
+        if (isSpecial) return static_cast<uint16_t>(commonNameCount + specialNames.acquire(gen));
+        return static_cast<uint16_t>(commonNames.acquire(gen));
+    }
+
+    // An NPC's level: within two of the player's, and at least 1.
+    static int drawLevel(int playerLevel, CounterRng& gen) {
+        int minLevel = std::max(1, playerLevel - 2);
+        int maxLevel = playerLevel + 2;
+        return gen.range(minLevel, maxLevel);
+    }
+
+    // Whether to ask lockName for a special character: one draw, true one time in ten.
+    static bool wantsSpecialName(CounterRng& gen) { return gen.chance(0.1f); }
+
+private:
+
+    static int baseWage(int level) { return 10 + level * 2; }
+
+    static bool isSpecialName(uint16_t nameId) { return nameId >= commonNameCount; }
+
+    uint16_t drawNameId(CounterRng& gen) {
+        bool wantsSpecial = wantsSpecialName(gen);
+        return lockName(wantsSpecial, gen);
+    }
+
+    void releaseNameId(uint16_t nameId) {
+        if (isSpecialName(nameId)) specialNames.release(nameId - commonNameCount);
+        else commonNames.release(nameId);
+    }
+
+    static void applyName(NPC& npc, uint16_t nameId) {
+        npc.nameId = nameId;
+        if (isSpecialName(nameId)) {
+            size_t specialIdx = nameId - commonNameCount;
+            npc.name = string(NPCText::specialCharacters[specialIdx]);
+            npc.wagePerWeek *= 2;
+            const NPCText::LineRange lines = NPCText::specialDialogues[specialIdx];
+            npc.dialogues = {};
+            for (uint8_t i = 0; i < lines.count; ++i) {
+                npc.dialogues.push_back(static_cast<uint8_t>(lines.first + i));
+            }
+        } else {
+            npc.name = string(NPCText::firstNames[nameId / NPCText::lastNames.size()]);
+            npc.name += ' ';
+            npc.name += NPCText::lastNames[nameId % NPCText::lastNames.size()];
+        }
+    }
+
+    NameAllocator commonNames;  // id = first name index * lastNames.size() + last name index
+    NameAllocator specialNames; // id = index into NPCText::specialCharacters
+};
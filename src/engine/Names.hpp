@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Debuffs.hpp"
+
+// Every database name interned once, plus the cross-references between tables (weapon and spell
+// debuffs, event enemies) resolved to ids up front. Gameplay stores and compares ids only.
+class NameRegistry {
+public:
+    NameTable<DebuffId> debuffs{gameData().debuffs.byName};
+    NameTable<SpellId> spells{gameData().spells.byName};
+    NameTable<EnemyId> enemies{gameData().enemies.byName};
+    NameTable<EquipmentId> equipment{gameData().equipment.byName};
+    NameTable<LocationId> locations{gameData().locations.byName};
+    NameTable<EventId> events{gameData().events.byName};
+
+    // Indexed by the owning record; names the debuff table does not define are dropped here once
+    // instead of being skipped on every hit.
+    std::vector<std::vector<DebuffId>> weaponDebuffs;
+    std::vector<std::vector<DebuffId>> spellDebuffs;
+    std::vector<EnemyId> eventEnemies; // invalid for events without an encounter
+
+    NameRegistry() {
+        const GameData& data = gameData();
+        for (const auto& debuff : data.debuffs.getDebuffs()) debuffs.add(debuff.name);
+
+        for (size_t i = 0; i < data.spells.getSpells().size(); ++i) {
+            spells.add(data.spells.getSpells()[i].spellName);
+            spellDebuffs.push_back(resolveDebuffs(data.spells.getSpellText()[i].debuffs));
+        }
+
+        for (const auto& tmpl : data.enemies.templates) enemies.add(tmpl.name);
+
+        for (size_t i = 0; i < data.equipment.getEquipment().size(); ++i) {
+            equipment.add(data.equipment.getEquipment()[i].name);
+            weaponDebuffs.push_back(resolveDebuffs(data.equipment.getEquipmentText()[i].debuffs));
+        }
+
+        for (const auto& loc : data.locations.getLocations()) locations.add(loc.name);
+
+        for (const auto& ev : data.events.getEvents()) {
+            events.add(ev.name);
+            eventEnemies.push_back(ev.enemyEncounter ? enemies.find(ev.enemyName) : EnemyId());
+        }
+    }
+
+private:
+    template <class NameList>
+    std::vector<DebuffId> resolveDebuffs(const NameList& names) const {
+        std::vector<DebuffId> ids;
+        for (const auto& name : names) {
+            DebuffId id = debuffs.find(name);
+            if (id.valid()) ids.push_back(id);
+        }
+        return ids;
+    }
+};
+
+inline const NameRegistry& nameRegistry() {
+    static const NameRegistry registry;
+    return registry;
+}
+
+inline std::string_view Enemy::name() const { return nameRegistry().enemies.name(id); }
+
+// Ids of a "seen so far" set ordered by display name, for the dictionary screens.
+template <class Id>
+std::vector<Id> sortedByName(const std::set<Id>& ids, const NameTable<Id>& table) {
+    std::vector<Id> sorted(ids.begin(), ids.end());
+    std::sort(sorted.begin(), sorted.end(), [&](Id a, Id b) { return table.name(a) < table.name(b); });
+    return sorted;
+}
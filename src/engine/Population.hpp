@@ -0,0 +1,113 @@
+#pragma once
+
+#include "NPC.hpp"
+
+#include <atomic>
+#include <thread>
+
+struct PopulationConfig {
+    // An upper bound: residents hold names from the same pool as tavern hires, so when the
+    // settlements would use up more than the pool minus reservedNames, each gets an equal share.
+    uint32_t residentsPerSettlement = 250;
+    uint32_t reservedNames = 64; // left free for the tavern
+    unsigned threads = 0; // 0 uses every hardware thread
+    uint64_t seed = 1;
+};
+
+// The residents of every settlement, back to back in one array and grouped by location. Their
+// names are locked in the NPCGenerator that populated them, the same one the tavern hires from,
+// so nobody the player meets shares a name with a resident.
+class WorldPopulation {
+public:
+    // Empty for a location nobody lives in.
+    TableView<ResidentNPC> residentsOf(size_t location) const {
+        if (location + 1 >= firstResident.size()) return {};
+        return {residents.data() + firstResident[location], firstResident[location + 1] - firstResident[location]};
+    }
+
+    TableView<ResidentNPC> all() const { return {residents.data(), residents.size()}; }
+    size_t size() const { return residents.size(); }
+
+    ResidentNPC& operator[](size_t i) { return residents[i]; }
+
+    // Hands every resident's name back to the generator that populated the world.
+    void releaseNames(NPCGenerator& names) const {
+        for (const auto& resident : residents) names.releaseName(resident);
+    }
+
+private:
+    friend class PopulationGenerator;
+
+    std::vector<ResidentNPC> residents;
+    std::vector<uint32_t> firstResident; // per location, plus one past the end
+};
+
+// Fills every PeacefulTown and PeacefulVillage with residents across all cores. Resident i is
+// drawn from its own stream, split from (config.seed, i), so results do not depend on the thread
+// count; only name locking runs on the calling thread, in resident order, since every settlement
+// draws from the one name pool. Bodies are left to NPCGenerator::materialize.
+class PopulationGenerator {
+public:
+    static bool isSettlement(LocationType type) { return type == PeacefulTown || type == PeacefulVillage; }
+
+    using Locations = TableView<locationDatabase::locationProperties>;
+
+    // Locks each resident's name in `names`; see PopulationConfig for how many residents fit.
+    WorldPopulation populate(const PopulationConfig& config, NPCGenerator& names,
+                             Locations locations = gameData().locations.getLocations()) const {
+        const size_t settlements = static_cast<size_t>(std::count_if(locations.begin(), locations.end(),
+                                                                     [](const auto& l) { return isSettlement(l.type); }));
+        const size_t free = names.namesAvailable();
+        const size_t budget = free > config.reservedNames ? free - config.reservedNames : 0;
+        const uint32_t perSettlement = settlements == 0 ? 0
+            : static_cast<uint32_t>(std::min<size_t>(config.residentsPerSettlement, budget / settlements));
+
+        WorldPopulation world;
+        world.firstResident.reserve(locations.size() + 1);
+        std::vector<int> residentLevel; // the settlement difficulty each resident is drawn around
+        for (const auto& location : locations) {
+            world.firstResident.push_back(static_cast<uint32_t>(residentLevel.size()));
+            if (isSettlement(location.type)) residentLevel.insert(residentLevel.end(), perSettlement, location.difficultyLevel);
+        }
+        world.firstResident.push_back(static_cast<uint32_t>(residentLevel.size()));
+
+        const size_t count = residentLevel.size();
+
+        world.residents.resize(count);
+        std::vector<uint8_t> wantsSpecial(count);
+        const CounterRng root(config.seed);
+
+        const size_t blocks = (count + blockSize - 1) / blockSize;
+        unsigned threadCount = config.threads ? config.threads : std::max(1u, std::thread::hardware_concurrency());
+        threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, blocks));
+        std::atomic<size_t> nextBlock{0};
+
+        auto worker = [&]() {
+            for (size_t b = nextBlock++; b < blocks; b = nextBlock++) {
+                for (size_t i = b * blockSize; i < std::min(count, (b + 1) * blockSize); ++i) {
+                    CounterRng gen = root.split(i);
+                    ResidentNPC& resident = world.residents[i];
+                    resident.seed = gen.fork().streamKey();
+                    resident.level = static_cast<uint16_t>(NPCGenerator::drawLevel(residentLevel[i], gen));
+                    wantsSpecial[i] = NPCGenerator::wantsSpecialName(gen);
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threadCount; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+
+        CounterRng nameGen = root.split(nameStream);
+        for (size_t i = 0; i < count; ++i) {
+            ResidentNPC& resident = world.residents[i];
+            resident = NPCGenerator::makeResident(resident.seed, resident.level, names.lockName(wantsSpecial[i] != 0, nameGen));
+        }
+        return world;
+    }
+
+private:
+    static constexpr size_t blockSize = 256; // residents per work item; fewer is not worth a thread
+    static constexpr uint64_t nameStream = 0x6e61'6d65'7300ULL;
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "GameIO.hpp"
+
+#include <cstdint>
+
+// Counter-based randomness: draw n of a stream is a pure function of (key, n). A block of draws
+// has no loop-carried state, so loops over them compile to plain SIMD integer arithmetic.
+inline uint32_t mixBits(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+inline uint32_t counterBits(uint64_t key, uint64_t counter) {
+    uint32_t x = mixBits(static_cast<uint32_t>(counter) ^ static_cast<uint32_t>(key));
+    return mixBits(x ^ static_cast<uint32_t>(counter >> 32) ^ static_cast<uint32_t>(key >> 32));
+}
+
+// Uniform float in [0, 1) built from the top 24 bits, which a float represents exactly.
+inline float counterUniform(uint64_t key, uint64_t counter) {
+    return static_cast<float>(counterBits(key, counter) >> 8) * (1.0f / 16777216.0f);
+}
+
+// splitmix64 finalizer; turns related inputs (a seed and a stream id) into unrelated keys.
+inline uint64_t mixKey(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// The engine's only source of randomness. A stream is a key plus a draw counter, so copying one is
+// 16 bytes, and split(id) derives an independent child stream: one per session, per combat, per
+// simulation matchup or per worker thread, all reproducible from the root seed.
+// Meets UniformRandomBitGenerator, but below() and shuffle() are used in the engine instead of
+// std distributions so a seed replays identically on every standard library.
+class CounterRng {
+public:
+    using result_type = uint32_t;
+
+    CounterRng(uint64_t streamKey = 0) : key(streamKey), counter(0) {}
+
+    void reseed(uint64_t streamKey) {
+        key = streamKey;
+        counter = 0;
+    }
+
+    CounterRng split(uint64_t streamId) const { return CounterRng(mixKey(key ^ mixKey(streamId))); }
+
+    // A child stream that is different on every call; advances this stream by one draw.
+    CounterRng fork() { return split(0x8000000000000000ULL | counter++); }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFFU; }
+    result_type operator()() { return counterBits(key, counter++); }
+
+    float uniform() { return counterUniform(key, counter++); }
+    bool chance(float probability) { return uniform() < probability; }
+
+    // Uniform index in [0, n); n must be non-zero.
+    size_t below(size_t n) { return static_cast<size_t>((static_cast<uint64_t>((*this)()) * n) >> 32); }
+
+    // Uniform integer in [low, high].
+    int range(int low, int high) { return low + static_cast<int>(below(static_cast<size_t>(high - low) + 1)); }
+
+    template <class T>
+    const T& pick(const std::vector<T>& items) { return items[below(items.size())]; }
+
+    template <class It>
+    void shuffle(It first, It last) {
+        for (auto n = last - first; n > 1; --n) {
+            std::iter_swap(first + (n - 1), first + static_cast<decltype(n)>(below(static_cast<size_t>(n))));
+        }
+    }
+
+    // Hands out `count` consecutive counters for a caller that evaluates them in bulk.
+    uint64_t reserve(uint64_t count) {
+        uint64_t first = counter;
+        counter += count;
+        return first;
+    }
+
+    uint64_t streamKey() const { return key; }
+
+private:
+    uint64_t key;
+    uint64_t counter;
+};
+
+// Walker/Vose alias table: draws index i with probability weights[i] / sum(weights) using one
+// below() and at most one uniform(), whatever the number of outcomes. Outcomes whose column is
+// full skip the second draw, so equal weights consume the stream exactly like pick().
+class AliasTable {
+public:
+    AliasTable() = default;
+
+    explicit AliasTable(const std::vector<float>& weights) : threshold(weights.size(), 1.0f), alias(weights.size()) {
+        const size_t n = weights.size();
+        float total = 0.0f;
+        for (float w : weights) total += w;
+        if (n == 0 || total <= 0.0f) throw std::invalid_argument("AliasTable needs a positive total weight");
+
+        std::vector<float> scaled(n);
+        std::vector<uint32_t> small, large;
+        for (size_t i = 0; i < n; ++i) {
+            alias[i] = static_cast<uint32_t>(i);
+            scaled[i] = weights[i] * static_cast<float>(n) / total;
+            (scaled[i] < 1.0f ? small : large).push_back(static_cast<uint32_t>(i));
+        }
+        while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back(), l = large.back();
+            small.pop_back();
+            threshold[s] = scaled[s];
+            alias[s] = l;
+            scaled[l] -= 1.0f - scaled[s];
+            if (scaled[l] < 1.0f) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        // Whatever is left is 1 up to rounding and keeps its whole column.
+    }
+
+    size_t size() const { return threshold.size(); }
+    bool empty() const { return threshold.empty(); }
+
+    size_t sample(CounterRng& rng) const {
+        size_t column = rng.below(threshold.size());
+        if (threshold[column] >= 1.0f) return column;
+        return rng.uniform() < threshold[column] ? column : alias[column];
+    }
+
+private:
+    std::vector<float> threshold;
+    std::vector<uint32_t> alias;
+};
+
+inline CounterRng*& currentRandomStream() {
+    thread_local CounterRng* stream = nullptr;
+    return stream;
+}
+
+// The stream bound to this thread. A thread with nothing bound gets its own stream seeded from
+// std::random_device, which is what the console game wants when no seed is given.
+inline CounterRng& randomStream() {
+    if (CounterRng* stream = currentRandomStream()) return *stream;
+    thread_local CounterRng unseeded((static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}());
+    return unseeded;
+}
+
+// Binds a stream to the calling thread for the lifetime of the scope, like GameIOScope.
+class RandomScope {
+public:
+    RandomScope(CounterRng& stream) : previous(currentRandomStream()) { currentRandomStream() = &stream; }
+    ~RandomScope() { currentRandomStream() = previous; }
+    RandomScope(const RandomScope&) = delete;
+    RandomScope& operator=(const RandomScope&) = delete;
+
+private:
+    CounterRng* previous;
+};
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "Combat.hpp"
+
+#include <atomic>
+
+struct SimulationConfig {
+    int level = 1;
+    int fightsPerMatchup = 1000;
+    unsigned threads = 0; // 0 uses every hardware thread
+    uint64_t seed = 1;
+    int maxTurns = 200;
+    LocationType locationType = Terrain;
+    string classFilter;
+    string raceFilter;
+    string enemyFilter;
+    string weapon; // equipped on every hero, e.g. to test its debuffs; empty fights bare-handed
+};
+
+struct MatchupResult {
+    string className;
+    string raceName;
+    string enemyName;
+    int fights = 0;
+    int wins = 0;
+    long long turnsToKill = 0; // summed over won fights
+    long long hpRemaining = 0; // summed over won fights
+
+    double winRate() const { return fights > 0 ? static_cast<double>(wins) / fights : 0.0; }
+    double meanTurnsToKill() const { return wins > 0 ? static_cast<double>(turnsToKill) / wins : 0.0; }
+    double meanHpRemaining() const { return wins > 0 ? static_cast<double>(hpRemaining) / wins : 0.0; }
+};
+
+// Runs duels for every class x race x enemy matchup across all cores. The fights of one matchup
+// advance in lockstep, one batch damage kernel call per side per turn, with weapon debuff procs
+// and debuff ticks applied per fight as CombatSystem::attack and CombatScreen do.
+// Each matchup is seeded from (config.seed, matchup index), so results do not depend on the thread count.
+class CombatSimulator {
+public:
+    std::vector<MatchupResult> run(const SimulationConfig& config) const {
+        const PlayerClassCollection& classDb = gameData().classes;
+        const PlayerRaceDatabase& raceDb = gameData().races;
+        const EnemyDatabase& enemyDb = gameData().enemies;
+        EnemyController enemyCtrl;
+
+        std::vector<Player> heroes;
+        for (const auto& cls : classDb.templates) {
+            if (!config.classFilter.empty() && cls.name != config.classFilter) continue;
+            for (const auto& race : raceDb.templates) {
+                if (!config.raceFilter.empty() && race.name != config.raceFilter) continue;
+                Player hero = createPlayer(string(cls.name), race, cls);
+                for (int l = 1; l < config.level; ++l) {
+                    hero.gainLevel();
+                }
+                if (!config.weapon.empty()) equipWeapon(hero, config.weapon);
+                hero.stats.level = config.level;
+                heroes.push_back(hero);
+            }
+        }
+
+        std::vector<Enemy> enemies;
+        for (size_t i = 0; i < enemyDb.templates.size(); ++i) {
+            if (!config.enemyFilter.empty() && enemyDb.templates[i].name != config.enemyFilter) continue;
+            enemies.push_back(enemyCtrl.getEnemy(EnemyId(i), config.level, config.locationType));
+        }
+
+        std::vector<MatchupResult> results(heroes.size() * enemies.size());
+        if (results.empty()) return results;
+
+        unsigned threadCount = config.threads ? config.threads : std::max(1u, std::thread::hardware_concurrency());
+        threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, results.size()));
+        std::atomic<size_t> nextMatchup{0};
+
+        const CounterRng root(config.seed);
+        auto worker = [&]() {
+            CombatSystem combat(root);
+            FightLanes lanes;
+            for (size_t i = nextMatchup++; i < results.size(); i = nextMatchup++) {
+                const Player& baseHero = heroes[i / enemies.size()];
+                const Enemy& baseEnemy = enemies[i % enemies.size()];
+
+                combat.reseed(root.split(i));
+                CounterRng procs = root.split(i).split(procStream);
+
+                MatchupResult& result = results[i];
+                result.className = baseHero.playerClass.name;
+                result.raceName = baseHero.race.name;
+                result.enemyName = baseEnemy.name();
+                result.fights = config.fightsPerMatchup;
+
+                fightAll(combat, procs, baseHero, baseEnemy, config, lanes);
+                for (int f = 0; f < config.fightsPerMatchup; ++f) {
+                    if (lanes.enemyHp[f] <= 0 && lanes.heroHp[f] > 0) {
+                        result.wins++;
+                        result.turnsToKill += lanes.turns[f];
+                        result.hpRemaining += lanes.heroHp[f];
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threadCount; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+
+        return results;
+    }
+
+private:
+    static constexpr uint64_t procStream = 0x6465'6275'6666ULL; // weapon debuff rolls, per matchup
+
+    // The Gear layer and weapon debuffs PlayerInventory::equipWeapon would give.
+    static void equipWeapon(Player& hero, const string& weaponName) {
+        const EquipmentandWeaponDatabase& equipmentDb = gameData().equipment;
+        const size_t index = equipmentDb.byName.find(weaponName);
+        if (index == NameLookup::none) throw std::runtime_error("Unknown weapon: " + weaponName);
+        const auto& weapon = equipmentDb.getEquipment()[index];
+        Stats gear{};
+        gear.attack = weapon.attackIncrease;
+        gear.magicAttack = weapon.magicAttackIncrease;
+        hero.setStatLayer(StatLayer::Gear, gear);
+        hero.equippedWeaponDebuffs = nameRegistry().weaponDebuffs[index];
+        hero.equippedWeaponDebuffChance = weapon.debuffChance;
+    }
+
+    // The enemy side is per lane because debuffs land on different fights; the hero takes none
+    // (enemies carry no weapon debuffs, as in EnemyCombatant), so the hero side stays broadcast.
+    struct FightLanes {
+        std::vector<int> heroHp;
+        std::vector<int> enemyHp;
+        std::vector<int> turns;
+        std::vector<DebuffSet> enemyDebuffs;
+        std::vector<float> enemyAttack, enemyMagicAttack, enemyCritRate, enemyCritDamage;
+        std::vector<float> enemyArmor, enemyMagicArmor, enemyDodgeRate;
+        DamageLanes damage;
+    };
+
+    // Same penalties as the combatant stat getters.
+    static void refreshEnemyLane(const Enemy& enemy, FightLanes& lanes, size_t f) {
+        const auto& base = enemy.stats.data;
+        const DebuffModifiers& mods = lanes.enemyDebuffs[f].modifiers();
+        lanes.enemyAttack[f] = static_cast<float>(std::max(0, base.attack - mods.attack));
+        lanes.enemyMagicAttack[f] = static_cast<float>(std::max(0, base.magicAttack - mods.magicAttack));
+        lanes.enemyArmor[f] = std::max(0.0f, base.armor - mods.armor);
+        lanes.enemyMagicArmor[f] = std::max(0.0f, base.magicArmor - mods.magicArmor);
+    }
+
+    // Player swings first each turn, then the enemy, then debuffs tick, like CombatScreen.
+    static void fightAll(CombatSystem& combat, CounterRng& procs, const Player& baseHero, const Enemy& enemy,
+                         const SimulationConfig& config, FightLanes& lanes) {
+        const Stats& hero = baseHero.stats;
+        const auto& foe = enemy.stats.data;
+        const DebuffDatabase& debuffDb = gameData().debuffs;
+        const std::vector<DebuffId>& weaponDebuffs = baseHero.equippedWeaponDebuffs;
+        const size_t fights = static_cast<size_t>(config.fightsPerMatchup);
+
+        lanes.heroHp.assign(fights, hero.hitpoints);
+        lanes.enemyHp.assign(fights, foe.hitpoints);
+        lanes.turns.assign(fights, 0);
+        lanes.enemyDebuffs.assign(fights, enemy.debuffs);
+        lanes.enemyAttack.resize(fights);
+        lanes.enemyMagicAttack.resize(fights);
+        lanes.enemyArmor.resize(fights);
+        lanes.enemyMagicArmor.resize(fights);
+        lanes.enemyCritRate.assign(fights, foe.critRate);
+        lanes.enemyCritDamage.assign(fights, foe.critDamage);
+        lanes.enemyDodgeRate.assign(fights, foe.dodgeRate);
+        for (size_t f = 0; f < fights; ++f) refreshEnemyLane(enemy, lanes, f);
+
+        const float heroAttack[] = {static_cast<float>(hero.attack), static_cast<float>(hero.magicAttack), hero.critRate, hero.critDamage};
+        const float heroDefense[] = {hero.armor, hero.magicArmor, hero.dodgeRate};
+        const AttackerLanes heroAttacker{&heroAttack[0], &heroAttack[1], &heroAttack[2], &heroAttack[3]};
+        const TargetLanes heroTarget{&heroDefense[0], &heroDefense[1], &heroDefense[2]};
+        const AttackerLanes enemyAttacker{lanes.enemyAttack.data(), lanes.enemyMagicAttack.data(), lanes.enemyCritRate.data(), lanes.enemyCritDamage.data()};
+        const TargetLanes enemyTarget{lanes.enemyArmor.data(), lanes.enemyMagicArmor.data(), lanes.enemyDodgeRate.data()};
+
+        size_t running = fights;
+        for (int turn = 0; turn < config.maxTurns && running > 0; ++turn) {
+            combat.resolveBatch<true, false>(heroAttacker, enemyTarget, fights, lanes.damage);
+            for (size_t f = 0; f < fights; ++f) {
+                if (lanes.heroHp[f] <= 0 || lanes.enemyHp[f] <= 0) continue;
+                lanes.turns[f]++;
+                lanes.enemyHp[f] -= lanes.damage.total[f];
+                if (!lanes.damage.dodge[f] && !weaponDebuffs.empty() && procs.uniform() < baseHero.equippedWeaponDebuffChance) {
+                    lanes.enemyHp[f] -= lanes.enemyDebuffs[f].apply(debuffDb, procs.pick(weaponDebuffs));
+                    refreshEnemyLane(enemy, lanes, f);
+                }
+            }
+
+            combat.resolveBatch<false, true>(enemyAttacker, heroTarget, fights, lanes.damage);
+            running = 0;
+            for (size_t f = 0; f < fights; ++f) {
+                if (lanes.heroHp[f] <= 0 || lanes.enemyHp[f] <= 0) continue;
+                lanes.heroHp[f] -= lanes.damage.total[f];
+                DebuffSet& debuffs = lanes.enemyDebuffs[f];
+                if (!debuffs.empty()) {
+                    lanes.enemyHp[f] -= debuffs.tick(debuffDb, [](auto, int, bool) {});
+                    refreshEnemyLane(enemy, lanes, f);
+                }
+                if (lanes.heroHp[f] > 0 && lanes.enemyHp[f] > 0) running++;
+            }
+        }
+    }
+};
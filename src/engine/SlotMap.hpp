@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Refers to one value in a SlotMap. The generation changes whenever the slot is freed, so a
+// handle kept past an erase finds nothing instead of whatever reused the slot.
+struct SlotHandle {
+    static constexpr uint32_t none = UINT32_MAX;
+
+    uint32_t index = none;
+    uint32_t generation = 0;
+
+    constexpr bool valid() const { return index != none; }
+
+    friend constexpr bool operator==(SlotHandle a, SlotHandle b) { return a.index == b.index && a.generation == b.generation; }
+    friend constexpr bool operator!=(SlotHandle a, SlotHandle b) { return !(a == b); }
+};
+
+// Values in reusable slots with stable handles, plus a display order threaded through the slots
+// as a doubly linked list. Insert, erase, lookup and moving a value to the front are all O(1)
+// and never move other values, so pointers and handles stay good until their own erase.
+template <class T>
+class SlotMap {
+public:
+    // Appends at the end of the order.
+    SlotHandle pushBack(const T& value) {
+        uint32_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+            slots[index].value = value;
+        } else {
+            index = static_cast<uint32_t>(slots.size());
+            slots.push_back({value, 0, SlotHandle::none, SlotHandle::none, false});
+        }
+        Slot& slot = slots[index];
+        slot.live = true;
+        link(index, tail, SlotHandle::none);
+        ++count;
+        return {index, slot.generation};
+    }
+
+    bool erase(SlotHandle handle) {
+        if (!get(handle)) return false;
+        Slot& slot = slots[handle.index];
+        unlink(handle.index);
+        slot.live = false;
+        ++slot.generation;
+        slot.value = T();
+        freeSlots.push_back(handle.index);
+        --count;
+        return true;
+    }
+
+    T* get(SlotHandle handle) {
+        return const_cast<T*>(static_cast<const SlotMap&>(*this).get(handle));
+    }
+    const T* get(SlotHandle handle) const {
+        if (handle.index >= slots.size()) return nullptr;
+        const Slot& slot = slots[handle.index];
+        return slot.live && slot.generation == handle.generation ? &slot.value : nullptr;
+    }
+
+    void moveToFront(SlotHandle handle) {
+        if (!get(handle) || head == handle.index) return;
+        unlink(handle.index);
+        link(handle.index, SlotHandle::none, head);
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Calls f(handle, value) for every value, front to back.
+    template <class F>
+    void forEach(F&& f) const {
+        for (uint32_t i = head; i != SlotHandle::none; i = slots[i].next) {
+            f(SlotHandle{i, slots[i].generation}, slots[i].value);
+        }
+    }
+
+private:
+    struct Slot {
+        T value;
+        uint32_t generation;
+        uint32_t prev;
+        uint32_t next;
+        bool live;
+    };
+
+    void link(uint32_t index, uint32_t prev, uint32_t next) {
+        slots[index].prev = prev;
+        slots[index].next = next;
+        if (prev != SlotHandle::none) slots[prev].next = index;
+        else head = index;
+        if (next != SlotHandle::none) slots[next].prev = index;
+        else tail = index;
+    }
+
+    void unlink(uint32_t index) {
+        uint32_t prev = slots[index].prev, next = slots[index].next;
+        if (prev != SlotHandle::none) slots[prev].next = next;
+        else head = next;
+        if (next != SlotHandle::none) slots[next].prev = prev;
+        else tail = prev;
+    }
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    uint32_t head = SlotHandle::none;
+    uint32_t tail = SlotHandle::none;
+    size_t count = 0;
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "GameIO.hpp"
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+// Building blocks for the content tables. Records hold string_view and fixed-capacity lists, so a
+// whole table is a constexpr std::array that lives in read-only data with nothing to construct.
+// The same trivially copyable records are what a content blob stores (see ContentBlob.hpp).
+
+// Up to Capacity values stored inline, e.g. the debuffs of a weapon or the locations an enemy
+// spawns in. Iterates like the vector it replaces.
+template <class T, size_t Capacity>
+class FixedList {
+public:
+    constexpr FixedList() : items{}, count(0) {}
+    constexpr FixedList(std::initializer_list<T> init) : items{}, count(0) {
+        for (const T& item : init) {
+            if (count == Capacity) throw std::length_error("FixedList capacity exceeded");
+            items[count++] = item;
+        }
+    }
+
+    constexpr void push_back(const T& item) {
+        if (count == Capacity) throw std::length_error("FixedList capacity exceeded");
+        items[count++] = item;
+    }
+
+    constexpr const T* begin() const { return items.data(); }
+    constexpr const T* end() const { return items.data() + count; }
+    T* begin() { return items.data(); }
+    T* end() { return items.data() + count; }
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr const T& operator[](size_t i) const { return items[i]; }
+
+private:
+    std::array<T, Capacity> items;
+    size_t count;
+};
+
+// Turns a braced list of records into a std::array sized by the list, so adding a row never means
+// updating a count by hand.
+template <class T, size_t N>
+constexpr std::array<T, N> tableOf(const T (&rows)[N]) {
+    std::array<T, N> table{};
+    for (size_t i = 0; i < N; ++i) table[i] = rows[i];
+    return table;
+}
+
+// One row of a table as written in the literals and data files. Tables are stored as two
+// parallel arrays instead: Hot holds what play reads (stats, prices, spawn rules) and Cold the
+// descriptions, lore and debuff name lists only menus and startup touch, so scanning or
+// indexing the hot rows never pulls text through the cache.
+template <class Hot, class Cold>
+struct ContentRow {
+    Hot hot;
+    Cold cold;
+};
+
+// Copies one member out of every row, e.g. columnOf(rows, &Row::hot).
+template <class Row, class Part, size_t N>
+constexpr std::array<Part, N> columnOf(const std::array<Row, N>& rows, Part Row::*part) {
+    std::array<Part, N> column{};
+    for (size_t i = 0; i < N; ++i) column[i] = rows[i].*part;
+    return column;
+}
+
+// The rows of one table wherever they live: a built-in constexpr array or a mapped content blob.
+template <class T>
+class TableView {
+public:
+    using value_type = T;
+
+    constexpr TableView() : rows(nullptr), count(0) {}
+    constexpr TableView(const T* rows, size_t count) : rows(rows), count(count) {}
+    template <size_t N>
+    constexpr TableView(const std::array<T, N>& table) : rows(table.data()), count(N) {}
+
+    constexpr const T* begin() const { return rows; }
+    constexpr const T* end() const { return rows + count; }
+    constexpr const T* data() const { return rows; }
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr const T& operator[](size_t i) const { return rows[i]; }
+
+private:
+    const T* rows;
+    size_t count;
+};
+
+// Order of a NameIndex: by length first, which settles most comparisons without reading text.
+constexpr bool nameBefore(std::string_view a, std::string_view b) {
+    return a.size() != b.size() ? a.size() < b.size() : a < b;
+}
+
+// Read-only view of a NameIndex, whatever its size, for code that holds lookups of several tables.
+class NameLookup {
+public:
+    static constexpr size_t none = static_cast<size_t>(-1);
+
+    constexpr NameLookup(const std::string_view* sortedNames, const uint16_t* records, size_t count)
+        : sortedNames(sortedNames), records(records), count(count) {}
+
+    // Record index of the first row called `name`, or none.
+    constexpr size_t find(std::string_view name) const {
+        size_t low = 0, high = count;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (nameBefore(sortedNames[mid], name)) low = mid + 1;
+            else high = mid;
+        }
+        return low < count && sortedNames[low] == name ? records[low] : none;
+    }
+
+private:
+    const std::string_view* sortedNames;
+    const uint16_t* records;
+    size_t count;
+};
+
+// The names of a table sorted once at compile time, each paired with its row, so a lookup is a
+// binary search over contiguous names. Rows that share a
+// name keep table order, so a lookup lands on the first of them.
+template <size_t N>
+class NameIndex {
+public:
+    static_assert(N < 0xFFFF, "row numbers are stored as uint16_t");
+
+    template <class T>
+    constexpr NameIndex(const std::array<T, N>& rows, std::string_view T::*name) : sortedNames{}, records{} {
+        for (size_t i = 0; i < N; ++i) {
+            // Insertion sort; a strict comparison keeps equal names in row order.
+            size_t j = i;
+            for (; j > 0 && nameBefore(rows[i].*name, sortedNames[j - 1]); --j) {
+                sortedNames[j] = sortedNames[j - 1];
+                records[j] = records[j - 1];
+            }
+            sortedNames[j] = rows[i].*name;
+            records[j] = static_cast<uint16_t>(i);
+        }
+    }
+
+    constexpr size_t find(std::string_view name) const { return lookup().find(name); }
+    constexpr NameLookup lookup() const { return NameLookup(sortedNames.data(), records.data(), N); }
+
+private:
+    std::array<std::string_view, N> sortedNames;
+    std::array<uint16_t, N> records;
+};
+
+template <class T, size_t N>
+constexpr NameIndex<N> indexByName(const std::array<T, N>& rows, std::string_view T::*name) {
+    return NameIndex<N>(rows, name);
+}
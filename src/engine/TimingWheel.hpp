@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Schedules values to come due after a number of turns. Four levels of 64 slots each: level 0
+// holds what is due within the current 64-turn block, level L what is due in a later block of
+// 64^L turns, and anything further out waits in an overflow list. Entering a new block moves
+// that block's entries one level down, so each entry is touched at most once per level and a
+// turn costs only what comes due, not what is pending.
+template <class T>
+class TimingWheel {
+public:
+    uint64_t now() const { return current; }
+    size_t size() const { return pending; }
+    bool empty() const { return pending == 0; }
+
+    // Comes due on the advance() that reaches now() + turns; a delay under one turn counts as one.
+    void schedule(uint64_t turns, const T& value) {
+        place({current + (turns ? turns : 1), value});
+        ++pending;
+    }
+
+    // Moves to the next turn and calls onDue(value) for everything due on it, in scheduling order.
+    // onDue may schedule more values but must not call advance().
+    template <class F>
+    void advance(F&& onDue) {
+        ++current;
+        if ((current & (horizon - 1)) == 0) redistribute(overflow);
+        for (size_t level = levels - 1; level > 0; --level) {
+            if ((current & ((uint64_t(1) << (slotBits * level)) - 1)) == 0) {
+                redistribute(wheels[level][slotOf(current, level)]);
+            }
+        }
+        // Swapping with the emptied scratch leaves the slot its old capacity back, so once every
+        // slot has grown to its busiest turn, advancing allocates nothing.
+        due.swap(wheels[0][slotOf(current, 0)]);
+        pending -= due.size();
+        for (Entry& entry : due) onDue(entry.value);
+        due.clear();
+    }
+
+    void clear() {
+        for (auto& wheel : wheels) {
+            for (auto& slot : wheel) slot.clear();
+        }
+        overflow.clear();
+        pending = 0;
+    }
+
+private:
+    static constexpr size_t slotBits = 6;
+    static constexpr size_t slotsPerLevel = size_t(1) << slotBits;
+    static constexpr size_t levels = 4;
+    static constexpr uint64_t horizon = uint64_t(1) << (slotBits * levels);
+
+    struct Entry {
+        uint64_t due;
+        T value;
+    };
+
+    static size_t slotOf(uint64_t turn, size_t level) { return (turn >> (slotBits * level)) & (slotsPerLevel - 1); }
+
+    // The level is the highest 6-bit group in which the due turn differs from now.
+    void place(Entry entry) {
+        uint64_t differs = entry.due ^ current;
+        size_t level = 0;
+        while (level < levels && differs >= slotsPerLevel) {
+            differs >>= slotBits;
+            ++level;
+        }
+        if (level == levels) overflow.push_back(entry);
+        else wheels[level][slotOf(entry.due, level)].push_back(entry);
+    }
+
+    // Walks the entries from the scratch list, so an overflow entry still out of range can go
+    // straight back into the overflow list.
+    void redistribute(std::vector<Entry>& slot) {
+        cascade.swap(slot);
+        for (Entry& entry : cascade) place(entry);
+        cascade.clear();
+    }
+
+    std::array<std::array<std::vector<Entry>, slotsPerLevel>, levels> wheels;
+    std::vector<Entry> overflow;
+    std::vector<Entry> due;     // scratch for advance()
+    std::vector<Entry> cascade; // scratch for redistribute()
+    uint64_t current = 0;
+    size_t pending = 0;
+};
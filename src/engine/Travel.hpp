@@ -0,0 +1,229 @@
+#pragma once
+
+#include "CombatScreen.hpp"
+#include "Population.hpp"
+
+inline void handleEvent(Player& hero, EnemyController& enemyCtrl, CombatSystem& combat, PlayerInventory& playerInventory, PlayerController& heroStats, NPCGenerator& npcGen) {
+    const auto& events = gameData().events.getEvents();
+    const EventId eventId(randomStream().below(events.size()));
+    const auto& event = events[eventId.index()];
+
+    gameOut() << "\n=== EVENT: " << event.name << " ===" << endl;
+    gameOut() << gameData().events.getEventText()[eventId.index()].description << endl;
+
+
+    if (event.goldReward != 0) {
+        if (event.goldReward > 0) {
+            hero.economy.addCurrency(coins(0, 0, event.goldReward, 0));
+            gameOut() << "You gained " << event.goldReward << " silver!" << endl;
+        } else {
+            int goldToSubtract = -event.goldReward;
+            if (hero.economy.subtractCurrency(coins(0, 0, goldToSubtract, 0))) {
+                gameOut() << "You lost " << goldToSubtract << " silver!" << endl;
+            } else {
+                gameOut() << "You didn't have enough gold to lose!" << endl;
+            }
+        }
+    }
+
+    if (event.expReward != 0) {
+        if (event.expReward > 0) {
+            hero.stats.expe += event.expReward;
+            gameOut() << "You gained " << event.expReward << " experience!" << endl;
+            heroStats.levelUpChecker();
+        } else {
+            int expToSubtract = -event.expReward;
+            hero.stats.expe = std::max<float>(0.0f, hero.stats.expe - static_cast<float>(expToSubtract));
+            gameOut() << "You lost " << expToSubtract << " experience!" << endl;
+        }
+    }
+
+    if (event.healthEffect != 0) {
+        if (event.healthEffect > 0) {
+            int heal = std::min(event.healthEffect, hero.stats.maxHitpoints - hero.stats.hitpoints);
+            hero.stats.hitpoints += heal;
+            gameOut() << "You recovered " << heal << " HP!" << endl;
+        } else {
+            int damage = -event.healthEffect;
+            hero.stats.hitpoints -= damage;
+            if (hero.stats.hitpoints <= 0) {
+                hero.stats.hitpoints = 1;
+                gameOut() << "You took " << damage << " damage but survived!" << endl;
+            } else {
+                gameOut() << "You took " << damage << " damage!" << endl;
+            }
+        }
+    }
+
+    if (event.manaEffect != 0) {
+        if (event.manaEffect > 0) {
+            int restore = std::min(event.manaEffect, hero.stats.maxMana - hero.stats.mana);
+            hero.stats.mana += restore;
+            gameOut() << "You recovered " << restore << " Mana!" << endl;
+        } else {
+            int drain = -event.manaEffect;
+            hero.stats.mana = std::max<int>(0, hero.stats.mana - drain);
+            gameOut() << "You lost " << drain << " Mana!" << endl;
+        }
+    }
+
+
+    const EnemyId enemyId = nameRegistry().eventEnemies[eventId.index()];
+    if (enemyId.valid()) {
+        int enemyCount = std::max(1, event.enemyCount);
+        gameOut() << (enemyCount > 1 ? "\nYou encounter " + std::to_string(enemyCount) + " enemies!" : string("\nYou encounter an enemy!")) << endl;
+        CombatArena arena;
+        for (int i = 0; i < enemyCount; ++i) {
+            arena.addEnemy(enemyCtrl.getEnemy(enemyId, hero.stats.level, hero.currentLocationType));
+        }
+        std::vector<NPC> emptyParty;
+        clearScreen();
+        CombatScreen combatScreen(hero, emptyParty, arena, hero.timeSystem, npcGen);
+        combatScreen.startCombat(combat, playerInventory);
+        clearScreen();
+
+        if (hero.stats.hitpoints > 0) {
+            awardDefeatedEnemies(hero, arena, enemyCtrl);
+            heroStats.levelUpChecker();
+        }
+    }
+
+   
+    if (hero.encounteredEvents.insert(eventId).second) {
+        hero.hasNewDictionaryEntry = true;
+    }
+
+    gameOut() << "Press Enter to continue...";
+    waitForEnter();
+}
+
+class TravelSystem{
+    public:
+        TravelSystem(NPCGenerator& gen, const WorldPopulation& population, bool debugAllDiscovered = false) : npcGen(gen), world(population), discovered(locationDB.getLocations().size(), debugAllDiscovered), marked(locationDB.getLocations().size(), false) {}
+
+        void travel(Player& hero, EnemyController& enemyCtrl, CombatSystem& combat, PlayerInventory& playerInventory, PlayerController& heroStats, TimeSystem& timeSystem) {
+        clearScreen();
+        std::vector<string> lines = {
+            "1. Venture into the unknown -- uncover new lands and dangers",
+            "2. Follow safe routes -- travel to known, marked locations"
+        };
+            displayBorderedMenu(lines, "Choose an option: ");
+            int choice = getNumberInput(1, 2);
+
+    if (choice == 1) {
+        clearScreen();
+        exploreRandomLocation(hero, enemyCtrl, combat, playerInventory, heroStats, timeSystem);
+    } else {
+        clearScreen();
+        const auto& locations = locationDB.getLocations();
+                std::vector<size_t> markedLocations;
+                for (size_t i = 0; i < locations.size(); ++i) {
+                    if (marked[i]) {
+                        markedLocations.push_back(i);
+                    }
+                }
+                if (markedLocations.empty()) {
+                    gameOut() << "No marked locations.\n";
+                    return;
+                }
+                for (size_t j = 0; j < markedLocations.size(); ++j) {
+                    size_t i = markedLocations[j];
+                    gameOut() << j + 1 << ". " << locations[i].name << endl;
+                }
+                gameOut() << "Choose a location: ";
+                int locChoice = getNumberInput(1, static_cast<int>(markedLocations.size()));
+                size_t idx = markedLocations[locChoice - 1];
+                hero.currentLocation = locations[idx].name;
+                hero.currentLocationType = locations[idx].type;
+                enterLocation(hero, enemyCtrl, combat, playerInventory, heroStats, timeSystem, idx, true);
+            }
+        }
+
+        bool hasDiscoveredLocations() const {
+            return std::any_of(discovered.begin(), discovered.end(), [](bool d){ return d; });
+        }
+
+        void exploreRandomLocation(Player& hero, EnemyController& enemyCtrl, CombatSystem& combat, PlayerInventory& playerInventory, PlayerController& heroStats, TimeSystem& timeSystem) {
+            const auto& locations = locationDB.getLocations();
+            size_t idx = randomStream().below(locations.size());
+            bool firstTime = !discovered[idx];
+            discovered[idx] = true;
+    if (firstTime) {
+        hero.stats.expe += 50.0f;
+        gameOut() << "\nDiscovered new location: " << locations[idx].name << "! Gained 50 experience.\n";
+        heroStats.levelUpChecker();
+        hero.discoveredLocations.insert(LocationId(idx));
+        hero.hasNewDictionaryEntry = true;
+        
+    }
+    hero.currentLocation = locations[idx].name;
+    hero.currentLocationType = locations[idx].type;
+    enterLocation(hero, enemyCtrl, combat, playerInventory, heroStats, timeSystem, idx);
+        }
+
+    private:
+        NPCGenerator& npcGen;
+        const WorldPopulation& world;
+        const locationDatabase& locationDB = gameData().locations;
+        std::vector<bool> discovered;
+        std::vector<bool> marked;
+
+    void enterLocation(Player& hero, EnemyController& enemyCtrl, CombatSystem& combat, PlayerInventory& playerInventory, PlayerController& heroStats, TimeSystem& timeSystem, size_t locationIndex, bool isSafe = false) {
+        const auto& location = locationDB.getLocations()[locationIndex];
+        bool inLocation = true;
+        while (inLocation) {
+        clearScreen();
+
+            gameOut() << "\n=== " << location.name << " ===\n";
+            gameOut() << locationDB.getLocationText()[locationIndex].description << endl;
+            if (size_t residents = world.residentsOf(locationIndex).size()) {
+                gameOut() << residents << " people live here.\n";
+            }
+            gameOut() << "1. Explore\n";
+            gameOut() << "2. Mark location\n";
+            gameOut() << "3. Leave\n";
+            gameOut() << "Choose an action: ";
+            int action = getNumberInput(1, 3);
+
+            switch (action) {
+                case 1: {
+                    float enemyChance = isSafe ? 0.0f : 0.5f;
+                    if (!isSafe) {
+                        switch (location.type) {
+                            case PeacefulVillage: enemyChance = 0.2f; break;
+                            case PeacefulTown: enemyChance = 0.3f; break;
+                            case Dungeon: enemyChance = 0.8f; break;
+                            case Terrain: enemyChance = 0.6f; break;
+                            default: enemyChance = 0.5f; break;
+                        }
+                    }
+
+                if (randomStream().chance(enemyChance) && enemyCtrl.canEncounter(location.difficultyLevel, location.type)) {
+                   
+                    CombatArena arena;
+                    arena.addEnemy(enemyCtrl.encounterEnemy(location.difficultyLevel, location.type));
+                    std::vector<NPC> emptyParty;
+                    CombatScreen combatScreen(hero, emptyParty, arena, timeSystem, npcGen);
+                    combatScreen.startCombat(combat, playerInventory);
+
+                    if (hero.stats.hitpoints > 0) {
+                        awardDefeatedEnemies(hero, arena, enemyCtrl);
+                        heroStats.levelUpChecker();
+                    }
+                }
+  
+                handleEvent(hero, enemyCtrl, combat, playerInventory, heroStats, npcGen);
+                timeSystem.advanceTime(hero);
+                break;
+                }
+                case 2:
+                    marked[locationIndex] = true;
+                    gameOut() << "Location marked for safe travel.\n";
+                    break;
+                case 3:
+                    inLocation = false;
+                    break;
+            }
+        }
+    }
+};
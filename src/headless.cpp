@@ -0,0 +1,74 @@
+#include "engine/Engine.hpp"
+
+#include <fstream>
+
+// Scripted driver: replays a file of input lines against a Quick Start hero with no console,
+// e.g. `headless script.txt 1000` to run the script 1000 times and report throughput.
+// Session s draws from stream s of --seed (default 1), so a run replays exactly.
+int main(int argc, char* argv[]) {
+    const char* usage = "Usage: headless <script-file> [sessions] [--transcript] [--seed <n>] [--data <blob>]\n";
+    if (argc < 2) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    std::ifstream scriptFile(argv[1]);
+    if (!scriptFile) {
+        std::cerr << "Cannot open script: " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<string> script;
+    string line;
+    while (std::getline(scriptFile, line)) script.push_back(line);
+
+    int sessions = 1;
+    bool transcript = false;
+    uint64_t seed = 1;
+    for (int i = 2; i < argc; ++i) {
+        string arg = argv[i];
+        if ((arg == "--seed" || arg == "--data") && i + 1 == argc) {
+            std::cerr << "Missing value for " << arg << "\n" << usage;
+            return 1;
+        }
+        if (arg == "--transcript") transcript = true;
+        else if (arg == "--seed") seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--data") contentFile() = argv[++i];
+        else if (!arg.empty() && arg.find_first_not_of("0123456789") == string::npos) sessions = std::max(1, std::atoi(arg.c_str()));
+        else {
+            std::cerr << "Unknown option: " << arg << "\n" << usage;
+            return 1;
+        }
+    }
+
+    try {
+        gameData();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    const PlayerRaceDatabase& raceDb = gameData().races;
+    const PlayerClassCollection& classDb = gameData().classes;
+    size_t totalInputs = 0;
+    const CounterRng root(seed);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int s = 0; s < sessions; ++s) {
+        ScriptedIO io(script, transcript ? &std::cout : nullptr);
+        GameIOScope ioScope(io);
+        CounterRng session = root.split(static_cast<uint64_t>(s));
+        RandomScope randomScope(session);
+        Player hero = createPlayer("Gwensent", raceDb.templates[0], classDb.templates[0]);
+        try {
+            mainMenu(hero, true);
+        } catch (const InputClosed&) {
+        }
+        totalInputs += io.linesConsumed();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cerr << "sessions: " << sessions << "\n"
+              << "inputs: " << totalInputs << "\n"
+              << "seconds: " << elapsed << "\n"
+              << "inputs/sec: " << (elapsed > 0 ? totalInputs / elapsed : 0.0) << "\n";
+    return 0;
+}
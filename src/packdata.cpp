@@ -0,0 +1,88 @@
+#include "engine/ContentText.hpp"
+
+#include <filesystem>
+
+// Content compiler for the data files, e.g.
+//   packdata --export data        writes the built-in tables as editable text, one file per table
+//   packdata data content.bin     packs data/*.txt into a blob for `rpg --data content.bin`
+// A table with no file in the directory is packed from the built-in rows.
+
+static int exportContent(const string& dir) {
+    std::filesystem::create_directories(dir);
+    const GameData builtin;
+    forEachContentTable(builtin, [&](const char* stem, const auto&, const auto& rows, const auto& text, auto) {
+        string path = dir + "/" + stem + ".txt";
+        writeContentFile(path, rows, text);
+        std::cerr << path << ": " << rows.size() << " records\n";
+    });
+    return 0;
+}
+
+// Names one table uses to refer to another; the engine skips unknown ones, so flag them here.
+static int checkReferences(const GameData& data) {
+    int warnings = 0;
+    auto checkDebuffs = [&](const char* table, std::string_view owner, const FixedList<std::string_view, 3>& debuffs) {
+        for (std::string_view debuff : debuffs) {
+            if (data.debuffs.byName.find(debuff) != NameLookup::none) continue;
+            std::cerr << "warning: " << table << " '" << owner << "' names unknown debuff '" << debuff << "'\n";
+            ++warnings;
+        }
+    };
+    const auto& equipment = data.equipment.getEquipment();
+    for (size_t i = 0; i < equipment.size(); ++i) checkDebuffs("equipment", equipment[i].name, data.equipment.getEquipmentText()[i].debuffs);
+    const auto& spells = data.spells.getSpells();
+    for (size_t i = 0; i < spells.size(); ++i) checkDebuffs("spell", spells[i].spellName, data.spells.getSpellText()[i].debuffs);
+    const auto& enemies = data.enemies.templates;
+    for (size_t i = 0; i < enemies.size(); ++i) checkDebuffs("enemy", enemies[i].name, data.enemies.text[i].debuffs);
+    for (const auto& ev : data.events.getEvents()) {
+        if (!ev.enemyEncounter || data.enemies.byName.find(ev.enemyName) != NameLookup::none) continue;
+        std::cerr << "warning: event '" << ev.name << "' names unknown enemy '" << ev.enemyName << "'\n";
+        ++warnings;
+    }
+    return warnings;
+}
+
+static int packContent(const string& dir, const string& out) {
+    const GameData builtin;
+    ContentBlobWriter writer;
+    forEachContentTable(builtin, [&](const char* stem, const auto&, const auto& rows, const auto& text, auto name) {
+        using Record = typename std::decay_t<decltype(rows)>::value_type;
+        using Text = typename std::decay_t<decltype(text)>::value_type;
+        string path = dir + "/" + stem + ".txt";
+        if (!std::filesystem::exists(path)) {
+            std::cerr << path << ": missing, packing the built-in " << stem << "\n";
+            writer.add(rows, text, name);
+            return;
+        }
+        string contents;
+        std::vector<ContentRow<Record, Text>> records = readContentFile<ContentRow<Record, Text>>(path, contents);
+        std::vector<Record> hot;
+        std::vector<Text> cold;
+        for (const auto& row : records) {
+            hot.push_back(row.hot);
+            cold.push_back(row.cold);
+        }
+        writer.add(TableView<Record>(hot.data(), hot.size()), TableView<Text>(cold.data(), cold.size()), name);
+        std::cerr << path << ": " << records.size() << " records\n";
+    });
+    writer.save(out);
+
+    // Load the blob the way the game will, which also validates it.
+    const GameData packed(out);
+    int warnings = checkReferences(packed);
+    std::cerr << "wrote " << out << (warnings ? " with " + std::to_string(warnings) + " warnings" : "") << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        if (argc == 3 && string(argv[1]) == "--export") return exportContent(argv[2]);
+        if (argc == 3) return packContent(argv[1], argv[2]);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    std::cerr << "Usage: packdata --export <dir>\n"
+              << "       packdata <dir> <blob>\n";
+    return 1;
+}
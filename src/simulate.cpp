@@ -0,0 +1,63 @@
+#include "engine/Simulation.hpp"
+
+#include <iomanip>
+
+// Batch combat simulator, e.g. `simulate --level 4 --fights 100000 --class Sorcerer --enemy "Dragon Hatchling"`.
+// Prints one CSV row per class x race x enemy matchup.
+int main(int argc, char* argv[]) {
+    const char* usage = "Options: --level --fights --threads --seed --max-turns --class --race --enemy --weapon --data\n";
+    SimulationConfig config;
+    for (int i = 1; i < argc; i += 2) {
+        string flag = argv[i];
+        string value = i + 1 < argc ? argv[i + 1] : "";
+        if (flag == "--level") config.level = std::max(1, std::atoi(value.c_str()));
+        else if (flag == "--fights") config.fightsPerMatchup = std::max(1, std::atoi(value.c_str()));
+        else if (flag == "--threads") config.threads = static_cast<unsigned>(std::atoi(value.c_str()));
+        else if (flag == "--seed") config.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (flag == "--max-turns") config.maxTurns = std::max(1, std::atoi(value.c_str()));
+        else if (flag == "--class") config.classFilter = value;
+        else if (flag == "--race") config.raceFilter = value;
+        else if (flag == "--enemy") config.enemyFilter = value;
+        else if (flag == "--weapon") config.weapon = value;
+        else if (flag == "--data") contentFile() = value;
+        else {
+            std::cerr << "Unknown option: " << flag << "\n" << usage;
+            return 1;
+        }
+        if (i + 1 == argc) {
+            std::cerr << "Missing value for " << flag << "\n" << usage;
+            return 1;
+        }
+    }
+
+    try {
+        gameData();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    CombatSimulator simulator;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<MatchupResult> results;
+    try {
+        results = simulator.run(config);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "class,race,enemy,level,fights,win_rate,mean_turns_to_kill,mean_hp_remaining\n";
+    std::cout << std::fixed << std::setprecision(4);
+    long long totalFights = 0;
+    for (const auto& r : results) {
+        std::cout << r.className << "," << r.raceName << "," << r.enemyName << "," << config.level << ","
+                  << r.fights << "," << r.winRate() << "," << r.meanTurnsToKill() << "," << r.meanHpRemaining() << "\n";
+        totalFights += r.fights;
+    }
+
+    std::cerr << results.size() << " matchups, " << totalFights << " fights in " << elapsed << "s ("
+              << (elapsed > 0 ? totalFights / elapsed : 0.0) << " fights/s)\n";
+    return 0;
+}
@@ -0,0 +1,242 @@
+#include "engine/Engine.hpp"
+
+// Regression checks for game rules that the scripted transcripts do not pin down, e.g.
+//   tests
+//   tests --filter Ward
+// Prints one line per test and exits 1 if any check fails.
+
+struct CheckFailed : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+static void check(bool condition, const char* expression, int line) {
+    if (!condition) throw CheckFailed("line " + std::to_string(line) + ": " + expression);
+}
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static Player testHero(const string& className = "Sorcerer") {
+    const GameData& data = gameData();
+    return createPlayer("Gwensent", data.races.templates[0], data.classes.getClassTemplate(className));
+}
+
+// The cheapest spell that raises armor, so the hero can afford it at level 1.
+static SpellId cheapestWard() {
+    const auto& spells = gameData().spells.getSpells();
+    size_t ward = spells.size();
+    for (size_t i = 0; i < spells.size(); ++i) {
+        if (spells[i].armorIncrease <= 0) continue;
+        if (ward == spells.size() || spells[i].manaCost < spells[ward].manaCost) ward = i;
+    }
+    CHECK(ward < spells.size());
+    return SpellId(ward);
+}
+
+// Plays one fight against a lone Wolf, feeding `input` as the player's choices.
+static void fight(Player& hero, const std::vector<string>& input) {
+    ScriptedIO io(input);
+    GameIOScope ioScope(io);
+    CounterRng stream(7);
+    RandomScope randomScope(stream);
+    std::vector<NPC> party;
+    NPCGenerator npcGen;
+    CombatArena arena;
+    EnemyController enemyCtrl;
+    arena.addEnemy(enemyCtrl.getEnemyByName("Wolf", hero.stats.level));
+    TimeSystem timeSystem;
+    CombatSystem combat;
+    PlayerInventory inventory;
+    CombatScreen screen(hero, party, arena, timeSystem, npcGen);
+    screen.startCombat(combat, inventory);
+}
+
+// Buys one piece of equipment by name through the store menu.
+static void buyEquipment(Player& hero, std::string_view name) {
+    const size_t index = gameData().equipment.byName.find(name);
+    CHECK(index != NameLookup::none);
+    // A number off the first page turns to its page, and the same number then picks it.
+    std::vector<string> input = {"2", std::to_string(index + 1)};
+    if (index >= 5) input.push_back(input.back());
+    input.push_back("3");
+    ScriptedIO io(input);
+    GameIOScope ioScope(io);
+    PlayerInventory inventory;
+    Store store(inventory);
+    store.openStore(hero);
+}
+
+int main(int argc, char* argv[]) {
+    string filter;
+    const char* usage = "Options: --filter <substring>\n";
+    for (int i = 1; i < argc; i += 2) {
+        string flag = argv[i];
+        string value = i + 1 < argc ? argv[i + 1] : "";
+        if (flag == "--filter") filter = value;
+        else {
+            std::cerr << "Unknown option: " << flag << "\n" << usage;
+            return 1;
+        }
+        if (i + 1 == argc) {
+            std::cerr << "Missing value for " << flag << "\n" << usage;
+            return 1;
+        }
+    }
+
+    std::vector<std::pair<string, std::function<void()>>> tests = {
+        {"CombatScreen: a spell ward ends with the fight", [] {
+            Player hero = testHero();
+            const SpellId ward = cheapestWard();
+            const auto& spell = gameData().spells.getSpells()[ward.index()];
+            hero.learnedSpells.push_back(ward);
+            CHECK(hero.stats.mana >= spell.manaCost);
+            const float armor = hero.stats.armor;
+            const int mana = hero.stats.mana;
+
+            // Cast the ward, then run on the next round.
+            fight(hero, {"4", "1", "3"});
+            CHECK(hero.stats.mana == mana - spell.manaCost);
+            CHECK(hero.stats.armor == armor);
+            CHECK(hero.statLayers.layer(StatLayer::SpellWards).armor == 0.0f);
+
+            // Nothing from the first fight shows up in the next one either.
+            fight(hero, {"3"});
+            CHECK(hero.stats.armor == armor);
+        }},
+        {"CombatScreen: a ward stacks within one fight", [] {
+            Player hero = testHero();
+            const SpellId ward = cheapestWard();
+            const auto& spell = gameData().spells.getSpells()[ward.index()];
+            hero.learnedSpells.push_back(ward);
+            const float armor = hero.stats.armor;
+            try {
+                fight(hero, {"4", "1"});
+            } catch (const InputClosed&) {
+            }
+            CHECK(hero.stats.armor == armor + spell.armorIncrease);
+        }},
+        {"EnemyController: enemies scale 10% per level above their own", [] {
+            EnemyController enemyCtrl;
+            const EnemyDatabase& enemyDB = gameData().enemies;
+            const auto& base = enemyDB.templates[enemyDB.byName.find("Wolf")].stats.data;
+            const int level = base.level + 4;
+            const Enemy wolf = enemyCtrl.getEnemyByName("Wolf", level, Terrain);
+            CHECK(wolf.stats.data.level == level);
+            CHECK(wolf.stats.data.maxHitpoints == static_cast<int>(std::round(base.maxHitpoints * 1.4f)));
+            CHECK(wolf.stats.data.attack == static_cast<int>(std::round(base.attack * 1.4f)));
+
+            const Enemy sameLevel = enemyCtrl.getEnemyByName("Wolf", base.level, Terrain);
+            CHECK(sameLevel.stats.data.maxHitpoints == base.maxHitpoints);
+            CHECK(!sameLevel.stats.scaled);
+        }},
+        {"EnemyController: gear does not change the enemies a hero meets", [] {
+            EnemyController enemyCtrl;
+            Player hero = testHero("Warrior");
+            for (int l = 1; l < 5; ++l) {
+                hero.stats.level += 1;
+                hero.gainLevel();
+            }
+            const Enemy before = enemyCtrl.getEnemyByName("Wolf", hero.stats.level);
+
+            Stats gear{};
+            gear.attack = 20;
+            gear.armor = 5.0f;
+            hero.setStatLayer(StatLayer::Gear, gear);
+            CHECK(hero.stats.level == 5);
+            const Enemy after = enemyCtrl.getEnemyByName("Wolf", hero.stats.level);
+            CHECK(after.stats.data.level == before.stats.data.level);
+            CHECK(after.stats.data.maxHitpoints == before.stats.data.maxHitpoints);
+            CHECK(after.stats.data.attack == before.stats.data.attack);
+        }},
+        {"Player: level-ups scale class and race stats but not gear", [] {
+            Player bare = testHero("Warrior");
+            Player geared = testHero("Warrior");
+            Stats gear{};
+            gear.attack = 20;
+            geared.setStatLayer(StatLayer::Gear, gear);
+            for (int l = 1; l < 5; ++l) {
+                bare.gainLevel();
+                geared.gainLevel();
+            }
+            CHECK(geared.stats.attack == bare.stats.attack + gear.attack);
+            CHECK(bare.stats.attack > testHero("Warrior").stats.attack);
+        }},
+        {"TavernCandidates: the same candidates with or without the worker", [] {
+            CounterRng stream(11);
+            RandomScope randomScope(stream);
+            // Unnamed candidates differ in their drawn level, class, stats and wage.
+            auto sameCandidate = [](const NPC& a, const NPC& b) {
+                return a.level == b.level && a.playerClass.name == b.playerClass.name &&
+                       a.stats.maxHitpoints == b.stats.maxHitpoints && a.stats.attack == b.stats.attack &&
+                       a.wagePerWeek == b.wagePerWeek;
+            };
+            TavernCandidates built;
+            TavernCandidates ahead;
+            for (int level = 1; level <= 3; ++level) {
+                ahead.prepare(level);
+                for (int i = 0; i < 6; ++i) {
+                    CHECK(sameCandidate(built.take(level), ahead.take(level)));
+                }
+            }
+        }},
+        {"PopulationGenerator: more settlements than names share the pool out", [] {
+            using Location = locationDatabase::locationProperties;
+            std::vector<Location> locations = {{"Road", 1, Terrain}};
+            for (int i = 0; i < 6; ++i) locations.push_back({"Hamlet", 1 + i, i % 2 ? PeacefulTown : PeacefulVillage});
+            NPCGenerator names;
+            const size_t pool = names.namesAvailable();
+            PopulationConfig config;
+            CHECK(config.residentsPerSettlement * 6 > pool);
+
+            const WorldPopulation world = PopulationGenerator().populate(config, names, {locations.data(), locations.size()});
+            CHECK(world.residentsOf(0).size() == 0);
+            const size_t perSettlement = world.residentsOf(1).size();
+            CHECK(perSettlement == (pool - config.reservedNames) / 6);
+            for (size_t l = 1; l < locations.size(); ++l) CHECK(world.residentsOf(l).size() == perSettlement);
+            CHECK(names.namesAvailable() == pool - world.size());
+
+            std::set<uint16_t> residentNames;
+            for (const auto& resident : world.all()) residentNames.insert(resident.nameId);
+            CHECK(residentNames.size() == world.size());
+
+            // Tavern hires draw from what is left and never take a resident's name.
+            while (names.namesAvailable() > 0) CHECK(residentNames.count(names.generateNPC(1).nameId) == 0);
+
+            world.releaseNames(names);
+            CHECK(names.namesAvailable() == world.size());
+        }},
+        {"PopulationGenerator: no room for residents leaves settlements empty", [] {
+            NPCGenerator names;
+            PopulationConfig config;
+            config.reservedNames = static_cast<uint32_t>(names.namesAvailable());
+            const WorldPopulation world = PopulationGenerator().populate(config, names);
+            CHECK(world.size() == 0);
+        }},
+        // Deliberate balance change: the store used to charge only the silver and copper part of a
+        // price, so the Halberd (1g) was free and the Magic Staff (1g 32s) cost 32s.
+        {"Store: equipment costs its full listed price, gold included", [] {
+            Player hero = testHero();
+            hero.economy = Economy(0, 1, 0, 0);
+            buyEquipment(hero, "Halberd");
+            CHECK(hero.economy.copper == 0);
+
+            hero.economy = Economy(0, 0, 32, 0);
+            buyEquipment(hero, "Magic Staff");
+            CHECK(hero.economy.copper == coins(0, 0, 32, 0));
+            hero.economy = Economy(0, 1, 32, 0);
+            buyEquipment(hero, "Magic Staff");
+            CHECK(hero.economy.copper == 0);
+        }},
+    };
+
+    int failures = 0;
+    for (auto& test : tests) {
+        if (!filter.empty() && test.first.find(filter) == string::npos) continue;
+        try {
+            test.second();
+            std::cout << "ok    " << test.first << "\n";
+        } catch (const std::exception& e) {
+            std::cout << "FAIL  " << test.first << " (" << e.what() << ")\n";
+            ++failures;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}